@@ -52,13 +52,7 @@ int main(void)
     
     /* Draw a pattern */
     printf("Drawing pattern...\n");
-    for (uint8_t y = 100; y < 120; y++) {
-        for (uint8_t x = 20; x < 100; x++) {
-            if ((x + y) % 2 == 0) {
-                ssd1681_write_point(SSD1681_COLOR_RED, x, y, 1);
-            }
-        }
-    }
+    ssd1681_fill_pattern(SSD1681_COLOR_RED, 20, 100, 99, 119, ssd1681_pattern_checker, SSD1681_ROP_OR);
     
     /* Draw a line */
     printf("Drawing line...\n");
@@ -15,9 +15,29 @@
 #include <string.h>
 #include <stdio.h>
 
-#define DISPLAY_WIDTH  200
-#define DISPLAY_HEIGHT 200
-#define BYTES_PER_ROW  (DISPLAY_WIDTH / 8)
+#define DISPLAY_WIDTH  SSD1681_PANEL_WIDTH
+#define DISPLAY_HEIGHT SSD1681_PANEL_HEIGHT
+#define BYTES_PER_ROW  SSD1681_PLANE_STRIDE
+#define PLANE_SIZE     SSD1681_PLANE_SIZE
+
+/* Gate count programmed by driver output control (MUX = height - 1, 9 bits) */
+#define DRIVER_OUTPUT_MUX (DISPLAY_HEIGHT - 1)
+
+/* Framebuffer rows are stored bottom-up to match the Y-decrement data entry mode */
+#define GRAM_ROW(y)        (DISPLAY_HEIGHT - 1 - (y))
+#define GRAM_INDEX(x, y)   (GRAM_ROW(y) * BYTES_PER_ROW + ((x) / 8))
+#define GRAM_BIT(x)        (0x80 >> ((x) % 8))
+
+/* Monochrome profile: the red plane is never allocated and red accesses fold to NULL */
+#ifdef SSD1681_MONOCHROME
+#define HAS_RED_PLANE 0
+#else
+#define HAS_RED_PLANE 1
+#endif
+
+_Static_assert(DISPLAY_WIDTH % 8 == 0, "SSD1681_PANEL_WIDTH must be a multiple of 8");
+_Static_assert(DRIVER_OUTPUT_MUX <= 0x1FF, "SSD1681_PANEL_HEIGHT exceeds the 9-bit gate MUX");
+_Static_assert(PLANE_SIZE <= UINT16_MAX, "Plane size must fit a 16-bit length");
 
 /* Global state */
 static struct {
@@ -25,10 +45,125 @@ static struct {
     bool initialized;
     uint8_t dc_state;  /* For 3-wire mode */
     spi_inst_t *spi;
-    uint8_t black_gram[DISPLAY_HEIGHT][BYTES_PER_ROW];
-    uint8_t red_gram[DISPLAY_HEIGHT][BYTES_PER_ROW];
+    uint32_t init_time_us;
+    const uint8_t *init_table;  /* Reused for panels added with ssd1681_attach_panel() */
+    bool gray_shown;  /* RED RAM holds grayscale bits, see ssd1681_show_gray() */
+    /* Active planes: internal storage or app-registered buffers (see ssd1681_set_framebuffers()) */
+    uint8_t (*black_gram)[BYTES_PER_ROW];
+    uint8_t (*red_gram)[BYTES_PER_ROW];
+#ifndef SSD1681_EXTERNAL_FRAMEBUFFER
+    uint8_t black_buf[DISPLAY_HEIGHT][BYTES_PER_ROW] __attribute__((aligned(4)));  /* Word access, see layers */
+#if HAS_RED_PLANE
+    uint8_t red_buf[DISPLAY_HEIGHT][BYTES_PER_ROW] __attribute__((aligned(4)));
+#endif
+#endif
 } g_ssd1681 = {0};
 
+/* Dither stage state (one image streamed at a time) */
+#define DITHER_THRESHOLD 128
+#define DITHER_RED_LUMA  76   /* Luma of pure red, (77 * 255) >> 8 */
+
+static struct {
+    bool active;
+    ssd1681_dither_mode_t mode;
+    ssd1681_pixel_format_t format;
+    uint16_t left;
+    uint16_t top;
+    uint16_t width;
+    uint16_t height;
+    uint16_t row;
+    /* Two-row error buffers (current/next), padded by one pixel on each side */
+    int16_t err_luma[2][DISPLAY_WIDTH + 2];
+    int16_t err_red[2][DISPLAY_WIDTH + 2];
+} g_dither = {0};
+
+#ifdef SSD1681_TRACE
+/* Bus trace ring buffer: oldest events are overwritten */
+static struct {
+    bool enabled;
+    bool data_open;   /* Last event is DATA and may be extended */
+    uint32_t head;    /* Next slot to write */
+    uint32_t total;   /* Events recorded since start */
+    ssd1681_trace_event_t events[SSD1681_TRACE_DEPTH];
+} g_trace = {0};
+
+static ssd1681_trace_event_t *ssd1681_trace_push(uint8_t kind)
+{
+    ssd1681_trace_event_t *ev = &g_trace.events[g_trace.head];
+    g_trace.head = (g_trace.head + 1) % SSD1681_TRACE_DEPTH;
+    g_trace.total++;
+
+    memset(ev, 0, sizeof(*ev));
+    ev->kind = kind;
+    ev->time_us = time_us_64();
+    return ev;
+}
+
+static void ssd1681_trace_cmd(uint8_t cmd)
+{
+    if (!g_trace.enabled) return;
+
+    ssd1681_trace_push(SSD1681_TRACE_CMD)->value = cmd;
+    g_trace.data_open = false;
+}
+
+/* Consecutive data writes after one command are folded into a single event */
+static void ssd1681_trace_data(const uint8_t *data, uint16_t len)
+{
+    if (!g_trace.enabled) return;
+
+    ssd1681_trace_event_t *ev;
+    if (g_trace.data_open) {
+        ev = &g_trace.events[(g_trace.head + SSD1681_TRACE_DEPTH - 1) % SSD1681_TRACE_DEPTH];
+    } else {
+        ev = ssd1681_trace_push(SSD1681_TRACE_DATA);
+        ev->value = 2166136261u;  /* FNV-1a offset basis */
+        g_trace.data_open = true;
+    }
+
+    for (uint16_t i = 0; i < len; i++) {
+        if (ev->len + i < sizeof(ev->head)) ev->head[ev->len + i] = data[i];
+        ev->value = (ev->value ^ data[i]) * 16777619u;
+    }
+    ev->len += len;
+}
+
+static void ssd1681_trace_busy(uint64_t start_us)
+{
+    if (!g_trace.enabled) return;
+
+    ssd1681_trace_event_t *ev = ssd1681_trace_push(SSD1681_TRACE_BUSY);
+    ev->time_us = start_us;
+    ev->value = (uint32_t)(time_us_64() - start_us);
+    g_trace.data_open = false;
+}
+
+#define TRACE_CMD(cmd)        ssd1681_trace_cmd(cmd)
+#define TRACE_DATA(data, len) ssd1681_trace_data(data, len)
+#define TRACE_BUSY(start)     ssd1681_trace_busy(start)
+#else
+#define TRACE_CMD(cmd)        ((void)0)
+#define TRACE_DATA(data, len) ((void)0)
+#define TRACE_BUSY(start)     ((void)0)
+#endif
+
+/* Frame submission queue: a single newest-wins slot */
+static struct {
+    bool pending;
+    uint8_t update_type;
+    bool refreshed;           /* last_refresh_us is valid */
+    uint64_t last_refresh_us;
+    uint64_t min_interval_us;
+    uint32_t coalesced;       /* Frames replaced before they reached the panel */
+} g_frame_queue = {0};
+
+static const uint8_t bayer_4x4[4][4] = {
+    { 0,  8,  2, 10},
+    {12,  4, 14,  6},
+    { 3, 11,  1,  9},
+    {15,  7, 13,  5},
+};
+
 /* SPI commands */
 #define CMD_DRIVER_OUTPUT_CONTROL     0x01
 #define CMD_GATE_DRIVING_VOLTAGE      0x03
@@ -37,6 +172,7 @@ static struct {
 #define CMD_DEEP_SLEEP_MODE           0x10
 #define CMD_DATA_ENTRY_MODE           0x11
 #define CMD_SW_RESET                  0x12
+#define CMD_TEMP_SENSOR_CONTROL       0x18
 #define CMD_MASTER_ACTIVATION         0x20
 #define CMD_DISPLAY_UPDATE_CONTROL    0x21
 #define CMD_DISPLAY_UPDATE_CONTROL_2  0x22
@@ -44,10 +180,25 @@ static struct {
 #define CMD_WRITE_RAM_RED             0x26
 #define CMD_VCOM_REGISTER             0x2C
 #define CMD_WRITE_LUT_REGISTER        0x32
+#define CMD_BORDER_WAVEFORM           0x3C
+#define CMD_END_OPTION                0x3F
 #define CMD_SET_RAM_X_ADDRESS_COUNTER 0x4E
 #define CMD_SET_RAM_Y_ADDRESS_COUNTER 0x4F
 #define CMD_SET_RAM_X_START_END       0x44
 #define CMD_SET_RAM_Y_START_END       0x45
+#define CMD_AUTO_WRITE_RAM_BW         0x46
+#define CMD_AUTO_WRITE_RAM_RED        0x47
+
+/* Auto write RAM pattern: A[7] first step value, A[6:4] step height, A[2:0] step width.
+ * Steps of 200 (0b111) cover the whole window with a single value. */
+#define AUTO_WRITE_FILL_ONES          0xF7
+#define AUTO_WRITE_FILL_ZEROS         0x77
+
+/* Display update control 2 for a register LUT: clock, analog, display mode 1, no OTP LUT load */
+#define UPDATE_SEQ_REGISTER_LUT       0xC7
+
+/* Bytes of the LUT proper (0x32), the rest of a gray waveform is voltages */
+#define GRAY_LUT_WAVEFORM_BYTES       153
 
 /* Static functions */
 static void ssd1681_spi_write_byte(uint8_t data);
@@ -56,9 +207,38 @@ static void ssd1681_write_data(uint8_t data);
 static void ssd1681_write_data_buf(const uint8_t *data, uint16_t len);
 static void ssd1681_reset(void);
 static void ssd1681_wait_busy(void);
-static void ssd1681_set_window(uint8_t x_start, uint8_t y_start, uint8_t x_end, uint8_t y_end);
-static void ssd1681_set_cursor(uint8_t x, uint8_t y);
+static void ssd1681_set_window(uint16_t x_start, uint16_t y_start, uint16_t x_end, uint16_t y_end);
+static void ssd1681_set_cursor(uint16_t x, uint16_t y);
+static void ssd1681_auto_fill_ram(ssd1681_color_t color, uint8_t pattern);
+static uint8_t *ssd1681_get_gram(ssd1681_color_t color);
 static void ssd1681_set_spi_mode_and_clk(ssd1681_config_t *config);
+static uint16_t ssd1681_init_table_length(const uint8_t *table);
+static void ssd1681_run_init_table(const uint8_t *table);
+
+/* Longest init table accepted, guards against a missing SSD1681_INIT_END */
+#define INIT_TABLE_MAX 1024
+
+/*
+ * Default init sequence. Everything after the SW reset is sent in a single CS transaction;
+ * none of these commands raise BUSY, so the final wait is only a guard.
+ */
+const uint8_t ssd1681_default_init_table[] = {
+    CMD_SW_RESET, 0,
+    SSD1681_INIT_DELAY_MS, 10,
+    SSD1681_INIT_WAIT_BUSY,
+    /* Gates from the geometry, GD=0 SM=0 TB=0 */
+    CMD_DRIVER_OUTPUT_CONTROL, 3, DRIVER_OUTPUT_MUX & 0xFF, (DRIVER_OUTPUT_MUX >> 8) & 0x01, 0x02,
+    /* Y decrement, X increment */
+    CMD_DATA_ENTRY_MODE, 1, 0x01,
+    /* Full-panel window */
+    CMD_SET_RAM_X_START_END, 2, 0x00, (DISPLAY_WIDTH - 1) / 8,
+    CMD_SET_RAM_Y_START_END, 4, 0x00, 0x00, (DISPLAY_HEIGHT - 1) & 0xFF, ((DISPLAY_HEIGHT - 1) >> 8) & 0xFF,
+    CMD_BORDER_WAVEFORM, 1, 0x05,
+    /* Internal temperature sensor */
+    CMD_TEMP_SENSOR_CONTROL, 1, 0x80,
+    SSD1681_INIT_WAIT_BUSY,
+    SSD1681_INIT_END,
+};
 
 /**
  * @brief Write a byte via SPI (handles both 3-wire and 4-wire)
@@ -95,6 +275,7 @@ static void ssd1681_write_cmd(uint8_t cmd)
         gpio_put(g_ssd1681.config.pin_dc, 0);  /* D/C = 0 (command) */
     }
     
+    TRACE_CMD(cmd);
     gpio_put(g_ssd1681.config.pin_cs, 0);  /* CS = 0 */
     ssd1681_spi_write_byte(cmd);
     gpio_put(g_ssd1681.config.pin_cs, 1);  /* CS = 1 */
@@ -112,6 +293,7 @@ static void ssd1681_write_data(uint8_t data)
         gpio_put(g_ssd1681.config.pin_dc, 1);  /* D/C = 1 (data) */
     }
     
+    TRACE_DATA(&data, 1);
     gpio_put(g_ssd1681.config.pin_cs, 0);
     ssd1681_spi_write_byte(data);
     gpio_put(g_ssd1681.config.pin_cs, 1);
@@ -129,6 +311,7 @@ static void ssd1681_write_data_buf(const uint8_t *data, uint16_t len)
         gpio_put(g_ssd1681.config.pin_dc, 1);
     }
     
+    TRACE_DATA(data, len);
     gpio_put(g_ssd1681.config.pin_cs, 0);
     for (uint16_t i = 0; i < len; i++) {
         ssd1681_spi_write_byte(data[i]);
@@ -154,6 +337,9 @@ static void ssd1681_reset(void)
  */
 static void ssd1681_wait_busy(void)
 {
+#ifdef SSD1681_TRACE
+    uint64_t start_us = time_us_64();
+#endif
 
     int32_t timeout = 1000000;  // 10 second timeout
 
@@ -165,12 +351,88 @@ static void ssd1681_wait_busy(void)
     }
 
     sleep_us(100); // Extra delay to ensure ready. This apparently is a known issue.
+
+    TRACE_BUSY(start_us);
+}
+
+/**
+ * @brief Check an init table, returns its length including SSD1681_INIT_END or 0 if malformed
+ */
+static uint16_t ssd1681_init_table_length(const uint8_t *table)
+{
+    uint16_t i = 0;
+
+    while (i < INIT_TABLE_MAX) {
+        uint8_t op = table[i++];
+        if (op == SSD1681_INIT_END) return i;
+        if (op == SSD1681_INIT_WAIT_BUSY) continue;
+        if (i >= INIT_TABLE_MAX) break;
+        i += (op == SSD1681_INIT_DELAY_MS) ? 1 : 1 + table[i];
+    }
+
+    return 0;
+}
+
+/**
+ * @brief Run an init table, batching consecutive commands into one CS transaction
+ */
+static void ssd1681_run_init_table(const uint8_t *table)
+{
+    bool selected = false;
+
+    ssd1681_set_spi_mode_and_clk(&g_ssd1681.config);
+
+    for (;;) {
+        uint8_t op = *table++;
+        if (op == SSD1681_INIT_END) break;
+
+        if (op == SSD1681_INIT_WAIT_BUSY || op == SSD1681_INIT_DELAY_MS) {
+            if (selected) {
+                gpio_put(g_ssd1681.config.pin_cs, 1);
+                selected = false;
+            }
+            if (op == SSD1681_INIT_WAIT_BUSY) {
+                ssd1681_wait_busy();
+            } else {
+                sleep_ms(*table++);
+            }
+            continue;
+        }
+
+        uint8_t len = *table++;
+        if (!selected) {
+            gpio_put(g_ssd1681.config.pin_cs, 0);
+            selected = true;
+        }
+
+        /* D/C is sampled per byte, so CS can stay low across commands */
+        TRACE_CMD(op);
+        if (g_ssd1681.config.spi_mode == SSD1681_SPI_3WIRE) {
+            g_ssd1681.dc_state = 0;
+            ssd1681_spi_write_byte(op);
+            g_ssd1681.dc_state = 1;
+            for (uint8_t i = 0; i < len; i++) {
+                ssd1681_spi_write_byte(table[i]);
+            }
+        } else {
+            gpio_put(g_ssd1681.config.pin_dc, 0);
+            spi_write_blocking(g_ssd1681.spi, &op, 1);
+            gpio_put(g_ssd1681.config.pin_dc, 1);
+            if (len) spi_write_blocking(g_ssd1681.spi, table, len);
+        }
+        if (len) TRACE_DATA(table, len);
+        table += len;
+    }
+
+    if (selected) {
+        gpio_put(g_ssd1681.config.pin_cs, 1);
+    }
 }
 
 /**
  * @brief Set RAM window
  */
-static void ssd1681_set_window(uint8_t x_start, uint8_t y_start, uint8_t x_end, uint8_t y_end)
+static void ssd1681_set_window(uint16_t x_start, uint16_t y_start, uint16_t x_end, uint16_t y_end)
 {
     /* Set RAM X address */
     ssd1681_write_cmd(CMD_SET_RAM_X_START_END);
@@ -188,7 +450,7 @@ static void ssd1681_set_window(uint8_t x_start, uint8_t y_start, uint8_t x_end,
 /**
  * @brief Set RAM cursor
  */
-static void ssd1681_set_cursor(uint8_t x, uint8_t y)
+static void ssd1681_set_cursor(uint16_t x, uint16_t y)
 {
     ssd1681_write_cmd(CMD_SET_RAM_X_ADDRESS_COUNTER);
     ssd1681_write_data(x / 8);
@@ -198,6 +460,113 @@ static void ssd1681_set_cursor(uint8_t x, uint8_t y)
     ssd1681_write_data((y >> 8) & 0xFF);
 }
 
+/**
+ * @brief Fill a controller RAM plane on-chip using the auto write RAM pattern command
+ * @note Costs two bytes on the bus instead of a full plane upload; blocks until BUSY drops
+ */
+static void ssd1681_auto_fill_ram(ssd1681_color_t color, uint8_t pattern)
+{
+    ssd1681_wait_busy();
+
+    ssd1681_set_window(0, 0, DISPLAY_WIDTH - 1, DISPLAY_HEIGHT - 1);
+    ssd1681_set_cursor(0, 0);
+
+    ssd1681_write_cmd((color == SSD1681_COLOR_BLACK) ? CMD_AUTO_WRITE_RAM_BW : CMD_AUTO_WRITE_RAM_RED);
+    ssd1681_write_data(pattern);
+    ssd1681_wait_busy();
+}
+
+/**
+ * @brief Get the active plane for a color, NULL if none is attached
+ */
+static uint8_t *ssd1681_get_gram(ssd1681_color_t color)
+{
+#if !HAS_RED_PLANE
+    if (color != SSD1681_COLOR_BLACK) return NULL;
+#endif
+
+    uint8_t (*gram)[BYTES_PER_ROW] = (color == SSD1681_COLOR_BLACK) ?
+                                     g_ssd1681.black_gram : g_ssd1681.red_gram;
+    return gram ? &gram[0][0] : NULL;
+}
+
+/**
+ * @brief Set (data=1) or clear one pixel of a plane, coordinates must already be checked
+ */
+static inline void ssd1681_gram_put(uint8_t *gram, uint16_t x, uint16_t y, uint8_t data)
+{
+    if (data) {
+        gram[GRAM_INDEX(x, y)] &= ~GRAM_BIT(x);
+    } else {
+        gram[GRAM_INDEX(x, y)] |= GRAM_BIT(x);
+    }
+}
+
+/**
+ * @brief Set pixels left..right of one plane row to value (0x00 inks, 0xFF clears), bytewise
+ */
+static inline void ssd1681_row_fill(uint8_t *row, uint16_t left, uint16_t right, uint8_t value)
+{
+    const uint16_t first = left / 8;
+    const uint16_t last = right / 8;
+    const uint8_t first_mask = 0xFF >> (left % 8);
+    const uint8_t last_mask = 0xFF << (7 - right % 8);
+
+    if (first == last) {
+        const uint8_t mask = first_mask & last_mask;
+        row[first] = (row[first] & ~mask) | (value & mask);
+        return;
+    }
+
+    row[first] = (row[first] & ~first_mask) | (value & first_mask);
+    if (last > first + 1) {
+        memset(&row[first + 1], value, last - first - 1);
+    }
+    row[last] = (row[last] & ~last_mask) | (value & last_mask);
+}
+
+/**
+ * @brief Combine pattern ink p with pixels left..right of one plane row, bytewise
+ */
+static inline void ssd1681_row_rop(uint8_t *row, uint16_t left, uint16_t right, uint8_t p, ssd1681_rop_t rop)
+{
+    const uint16_t first = left / 8;
+    const uint16_t last = right / 8;
+
+    for (uint16_t b = first; b <= last; b++) {
+        uint8_t mask = 0xFF;
+        if (b == first) mask &= 0xFF >> (left % 8);
+        if (b == last) mask &= 0xFF << (7 - right % 8);
+
+        /* Planes are active-low: ink is a cleared bit */
+        switch (rop) {
+            case SSD1681_ROP_OR:  row[b] &= ~(p & mask); break;
+            case SSD1681_ROP_AND: row[b] |= ~p & mask; break;
+            case SSD1681_ROP_XOR: row[b] ^= p & mask; break;
+            default:              row[b] = (row[b] & ~mask) | (~p & mask); break;
+        }
+    }
+}
+
+/**
+ * @brief Resolve the planes for a tri-color write, NULL red plane means none to touch
+ * @return 0, or -1 if a needed plane is missing
+ */
+static int ssd1681_tri_planes(ssd1681_tricolor_t color, uint8_t **black, uint8_t **red,
+                              uint8_t *black_value, uint8_t *red_value)
+{
+    if (color > SSD1681_TRI_RED) return -5;
+
+    *black = ssd1681_get_gram(SSD1681_COLOR_BLACK);
+    *red = ssd1681_get_gram(SSD1681_COLOR_RED);
+    if (!*black || (color == SSD1681_TRI_RED && !*red)) return -1;
+
+    /* Planes are active-low; red pixels leave the black plane white */
+    *black_value = (color == SSD1681_TRI_BLACK) ? 0x00 : 0xFF;
+    *red_value = (color == SSD1681_TRI_RED) ? 0x00 : 0xFF;
+    return 0;
+}
+
 /**
  * @brief Get default 4-wire configuration
  */
@@ -258,13 +627,11 @@ static void ssd1681_set_spi_mode_and_clk(ssd1681_config_t *config) {
 }
 
 /**
- * @brief Initialize the display
+ * @brief Bring up the bus and pins of a panel, reset it and run the init table
+ * @note Leaves the panel bound; the planes and driver state are not touched
  */
-int ssd1681_init(const ssd1681_config_t *config)
+static int ssd1681_panel_setup(const ssd1681_config_t *config, const uint8_t *table)
 {
-    if (!config) return -1;
-    if (g_ssd1681.initialized) return -2;
-    
     memcpy(&g_ssd1681.config, config, sizeof(ssd1681_config_t));
     g_ssd1681.dc_state = 0;
     
@@ -300,58 +667,100 @@ int ssd1681_init(const ssd1681_config_t *config)
     gpio_set_dir(config->pin_busy, GPIO_IN);
     gpio_pull_down(config->pin_busy);
     
-    /* Reset display */
+    /* Reset display, then the init table */
+    uint64_t start_us = time_us_64();
     ssd1681_reset();
-    sleep_ms(10);
-    ssd1681_wait_busy();
-    
-    /* Initialize display */
-    ssd1681_write_cmd(CMD_SW_RESET);
-    sleep_ms(10);
     ssd1681_wait_busy();
-    
-    /* Driver output control */
-    ssd1681_write_cmd(CMD_DRIVER_OUTPUT_CONTROL);
-    ssd1681_write_data(0xC7);  /* 200 - 1 */
-    ssd1681_write_data(0x00);
-    ssd1681_write_data(0x02);
+    ssd1681_run_init_table(table);
+    g_ssd1681.init_time_us = (uint32_t)(time_us_64() - start_us);
 
-    // ssd1681_set_soft_start(SSD1681_SOFTSTART_DRIVE_STRENGTH_0, SSD1681_SOFTSTART_TIME_40MS, SSD1681_SOFTSTART_MIN_OFF_4_6);
-    
-    /* Data entry mode */
-    ssd1681_write_cmd(CMD_DATA_ENTRY_MODE);
-    ssd1681_write_data(0x01);  /* Y decrement, X increment */
-    
-    /* Set window */
-    ssd1681_set_window(0, 0, DISPLAY_WIDTH - 1, DISPLAY_HEIGHT - 1);
-    
-    /* Border waveform */
-    ssd1681_write_cmd(0x3C);
-    ssd1681_write_data(0x05);
-    
-    /* Temperature sensor */
-    ssd1681_write_cmd(0x18);
-    ssd1681_write_data(0x80);  /* Internal sensor */
-    
-    /* Display update control */
-    // ssd1681_write_cmd(CMD_DISPLAY_UPDATE_CONTROL);
-    // ssd1681_write_data(0x00);
-    // ssd1681_write_data(0x80);
-    // ssd1681_write_cmd(CMD_DISPLAY_UPDATE_CONTROL_2);
-    // ssd1681_write_data(0xFF);
-    
-    /* Master activation */
-    // ssd1681_write_cmd(CMD_MASTER_ACTIVATION);
-    ssd1681_wait_busy();
+#if !HAS_RED_PLANE
+    /* No host red plane: put the controller's RED RAM in a known state once */
+    ssd1681_auto_fill_ram(SSD1681_COLOR_RED, AUTO_WRITE_FILL_ONES);
+#endif
+
+    return 0;
+}
+
+/**
+ * @brief Initialize the display
+ */
+int ssd1681_init(const ssd1681_config_t *config)
+{
+    return ssd1681_init_with_table(config, NULL);
+}
+
+/**
+ * @brief Initialize the display with a custom init table
+ */
+int ssd1681_init_with_table(const ssd1681_config_t *config, const uint8_t *table)
+{
+    if (!config) return -1;
+    if (g_ssd1681.initialized) return -2;
+
+    if (!table) table = ssd1681_default_init_table;
+    if (ssd1681_init_table_length(table) == 0) return -4;
     
+    int ret = ssd1681_panel_setup(config, table);
+    if (ret != 0) return ret;
+    g_ssd1681.init_table = table;
+
     /* Clear framebuffers */
-    memset(g_ssd1681.black_gram, 0xFF, sizeof(g_ssd1681.black_gram));
-    memset(g_ssd1681.red_gram, 0xFF, sizeof(g_ssd1681.red_gram));
+#ifdef SSD1681_EXTERNAL_FRAMEBUFFER
+    g_ssd1681.black_gram = NULL;
+    g_ssd1681.red_gram = NULL;
+#else
+    g_ssd1681.black_gram = g_ssd1681.black_buf;
+    memset(g_ssd1681.black_buf, 0xFF, sizeof(g_ssd1681.black_buf));
+#if HAS_RED_PLANE
+    g_ssd1681.red_gram = g_ssd1681.red_buf;
+    memset(g_ssd1681.red_buf, 0xFF, sizeof(g_ssd1681.red_buf));
+#endif
+#endif
+
+#if !HAS_RED_PLANE
+    g_ssd1681.red_gram = NULL;
+#endif
     
+    g_frame_queue.pending = false;
+
     g_ssd1681.initialized = true;
     return 0;
 }
 
+/**
+ * @brief Time the last init took
+ */
+uint32_t ssd1681_get_init_time_us(void)
+{
+    return g_ssd1681.init_time_us;
+}
+
+/**
+ * @brief Set up and initialize another panel driven by this driver
+ */
+int ssd1681_attach_panel(const ssd1681_config_t *config)
+{
+    if (!g_ssd1681.initialized) return -1;
+    if (!config) return -2;
+
+    return ssd1681_panel_setup(config, g_ssd1681.init_table);
+}
+
+/**
+ * @brief Route bus traffic to another panel
+ */
+int ssd1681_bind_panel(const ssd1681_config_t *config)
+{
+    if (!g_ssd1681.initialized) return -1;
+    if (!config) return -2;
+
+    memcpy(&g_ssd1681.config, config, sizeof(ssd1681_config_t));
+    g_ssd1681.spi = (config->spi_port == 0) ? spi0 : spi1;
+
+    return 0;
+}
+
 /**
  * @brief Deinitialize the display
  */
@@ -382,17 +791,13 @@ int ssd1681_clear(ssd1681_color_t color)
 {
     if (!g_ssd1681.initialized) return -1;
     
-    uint8_t *gram = (color == SSD1681_COLOR_BLACK) ? 
-                    &g_ssd1681.black_gram[0][0] : &g_ssd1681.red_gram[0][0];
+    uint8_t *gram = ssd1681_get_gram(color);
+    if (!gram) return -1;
     
-    memset(gram, 0xFF, DISPLAY_HEIGHT * BYTES_PER_ROW);
+    memset(gram, 0xFF, PLANE_SIZE);
 
-    // Write to RAM
-    // ssd1681_set_cursor(0, 0);
-    // ssd1681_write_cmd((color == SSD1681_COLOR_BLACK) ? CMD_WRITE_RAM_BW : CMD_WRITE_RAM_RED);
-    // ssd1681_write_data_buf(gram, DISPLAY_HEIGHT * BYTES_PER_ROW);
-
-    // ssd1681_update();
+    /* Keep controller RAM in sync without uploading the plane */
+    ssd1681_auto_fill_ram(color, AUTO_WRITE_FILL_ONES);
     
     return 0;
 }
@@ -404,8 +809,8 @@ int ssd1681_write_buffer(ssd1681_color_t color)
 {
     if (!g_ssd1681.initialized) return -1;
     
-    uint8_t *gram = (color == SSD1681_COLOR_BLACK) ? 
-                    &g_ssd1681.black_gram[0][0] : &g_ssd1681.red_gram[0][0];
+    uint8_t *gram = ssd1681_get_gram(color);
+    if (!gram) return -1;
 
     ssd1681_wait_busy();
     
@@ -418,7 +823,7 @@ int ssd1681_write_buffer(ssd1681_color_t color)
     
     /* Write buffer to display RAM */
     ssd1681_write_cmd((color == SSD1681_COLOR_BLACK) ? CMD_WRITE_RAM_BW : CMD_WRITE_RAM_RED);
-    ssd1681_write_data_buf(gram, DISPLAY_HEIGHT * BYTES_PER_ROW);
+    ssd1681_write_data_buf(gram, PLANE_SIZE);
     
     return 0;
 }
@@ -439,6 +844,21 @@ int ssd1681_set_soft_start(ssd1681_softstart_drive_strength_t strength,  ssd1681
     return 0;
 }
 
+/**
+ * @brief Put RED RAM back in step with the red plane after a grayscale image
+ */
+static void ssd1681_gray_restore(void)
+{
+    if (!g_ssd1681.gray_shown) return;
+    g_ssd1681.gray_shown = false;
+
+    if (ssd1681_get_gram(SSD1681_COLOR_RED)) {
+        ssd1681_write_buffer(SSD1681_COLOR_RED);
+    } else {
+        ssd1681_auto_fill_ram(SSD1681_COLOR_RED, AUTO_WRITE_FILL_ONES);
+    }
+}
+
 /**
  * @brief Update the display if display is ready
  * @return 0 on update, -1 if display is busy, -2 if invalid update type
@@ -452,6 +872,7 @@ int ssd1681_write_buffer_and_update_if_ready(uint8_t update_type)
         return -1; // Display is busy
     }
 
+    ssd1681_gray_restore();
 
     if (update_type == SSD1681_UPDATE_CLEAN_FULL) {
         ssd1681_write_buffer(SSD1681_COLOR_BLACK);
@@ -474,10 +895,7 @@ int ssd1681_write_buffer_and_update_if_ready(uint8_t update_type)
         ssd1681_write_cmd(CMD_MASTER_ACTIVATION);
 
     } else if(update_type == SSD1681_UPDATE_FAST_FULL) {
-        ssd1681_write_cmd(CMD_WRITE_RAM_BW);
-        for (uint16_t i = 0; i < sizeof(g_ssd1681.black_gram); i++) {
-            ssd1681_write_data(0xFF);
-        }
+        ssd1681_auto_fill_ram(SSD1681_COLOR_BLACK, AUTO_WRITE_FILL_ONES);
 
         ssd1681_write_cmd(CMD_DISPLAY_UPDATE_CONTROL);
         ssd1681_write_data(0x00);
@@ -528,6 +946,7 @@ int ssd1681_update(uint8_t update_type)
     if (!g_ssd1681.initialized) return -1;
 
     ssd1681_wait_busy();
+    ssd1681_gray_restore();
 
 
     if (update_type == SSD1681_UPDATE_CLEAN_FULL) {
@@ -572,22 +991,15 @@ int ssd1681_update(uint8_t update_type)
 /**
  * @brief Write a point
  */
-int ssd1681_write_point(ssd1681_color_t color, uint8_t x, uint8_t y, uint8_t data)
+int ssd1681_write_point(ssd1681_color_t color, uint16_t x, uint16_t y, uint8_t data)
 {
     if (!g_ssd1681.initialized) return -1;
     if (x >= DISPLAY_WIDTH || y >= DISPLAY_HEIGHT) return -2;
     
-    uint8_t *gram = (color == SSD1681_COLOR_BLACK) ? 
-                    &g_ssd1681.black_gram[0][0] : &g_ssd1681.red_gram[0][0];
+    uint8_t *gram = ssd1681_get_gram(color);
+    if (!gram) return -1;
     
-    uint16_t byte_index = (DISPLAY_HEIGHT - 1 - y) * BYTES_PER_ROW + (x / 8);
-    uint8_t bit_index = 7 - (x % 8);
-    
-    if (data) {
-        gram[byte_index] &= ~(1 << bit_index);
-    } else {
-        gram[byte_index] |= (1 << bit_index);
-    }
+    ssd1681_gram_put(gram, x, y, data);
     
     return 0;
 }
@@ -595,27 +1007,118 @@ int ssd1681_write_point(ssd1681_color_t color, uint8_t x, uint8_t y, uint8_t dat
 /**
  * @brief Read a point
  */
-int ssd1681_read_point(ssd1681_color_t color, uint8_t x, uint8_t y, uint8_t *data)
+int ssd1681_read_point(ssd1681_color_t color, uint16_t x, uint16_t y, uint8_t *data)
 {
     if (!g_ssd1681.initialized) return -1;
     if (x >= DISPLAY_WIDTH || y >= DISPLAY_HEIGHT) return -2;
     if (!data) return -3;
     
-    uint8_t *gram = (color == SSD1681_COLOR_BLACK) ? 
-                    &g_ssd1681.black_gram[0][0] : &g_ssd1681.red_gram[0][0];
+    uint8_t *gram = ssd1681_get_gram(color);
+    if (!gram) return -1;
     
-    uint16_t byte_index = y * BYTES_PER_ROW + (x / 8);
-    uint8_t bit_index = 7 - (x % 8);
+    uint16_t byte_index = GRAM_INDEX(x, y);
     
-    *data = (gram[byte_index] & (1 << bit_index)) ? 0 : 1;
+    *data = (gram[byte_index] & GRAM_BIT(x)) ? 0 : 1;
     
     return 0;
 }
 
+/**
+ * @brief Expand one 8px font row to font_size pixels, MSB-first (nearest-neighbour scaling)
+ */
+static void ssd1681_glyph_row_bits(uint8_t glyph_row, uint8_t font_size, uint8_t *bits)
+{
+    memset(bits, 0, (font_size + 7) / 8);
+    if (!glyph_row) return;
+
+    for (uint8_t col = 0; col < font_size; col++) {
+        if (glyph_row & (1 << (col * FONT_BASIC_SIZE / font_size))) {
+            bits[col / 8] |= 0x80 >> (col % 8);
+        }
+    }
+}
+
+/**
+ * @brief OR an MSB-first bit string into a scanline buffer at pixel x
+ */
+static void ssd1681_line_or_bits(uint8_t *line, int32_t x, const uint8_t *bits, uint8_t nbits)
+{
+    for (uint8_t k = 0; k < (nbits + 7) / 8; k++, x += 8) {
+        uint8_t v = bits[k];
+        if (!v || x <= -8) continue;
+        if (x >= DISPLAY_WIDTH) break;
+
+        if (x < 0) {
+            line[0] |= v << -x;
+            continue;
+        }
+
+        uint8_t shift = x % 8;
+        line[x / 8] |= v >> shift;
+        if (shift && x / 8 + 1 < BYTES_PER_ROW) {
+            line[x / 8 + 1] |= v << (8 - shift);
+        }
+    }
+}
+
+/**
+ * @brief Render a run of characters on one text line, clipped to clip
+ * @note Each scanline of the run is composed in a row buffer and merged into the plane
+ *       with whole-byte masked writes. ink: 1 draws glyph pixels, 0 erases them.
+ *       opaque: the character cells' background is painted white as well.
+ */
+static void ssd1681_text_run(uint8_t *gram, int32_t x, int32_t y, const char *str, uint16_t n,
+                             uint8_t font_size, const ssd1681_rect_t *clip, bool ink, bool opaque)
+{
+    int32_t left = (x > clip->left) ? x : clip->left;
+    int32_t right = x + (int32_t)n * font_size - 1;
+    if (right > clip->right) right = clip->right;
+    if (n == 0 || left > right) return;
+
+    const uint8_t first_mask = 0xFF >> (left % 8);
+    const uint8_t last_mask = 0xFF << (7 - right % 8);
+
+    uint8_t line[BYTES_PER_ROW];
+    uint8_t bits[32];
+
+    for (uint8_t row = 0; row < font_size; row++) {
+        int32_t py = y + row;
+        if (py < (int32_t)clip->top) continue;
+        if (py > (int32_t)clip->bottom) break;
+
+        memset(line, 0, sizeof(line));
+        const uint8_t src_row = row * FONT_BASIC_SIZE / font_size;
+        for (uint16_t i = 0; i < n; i++) {
+            uint8_t c = (uint8_t)str[i];
+            uint8_t glyph_row = (c > 127) ? 0 : (uint8_t)font_basic_8x8[c][src_row];
+            if (!glyph_row) continue;
+
+            ssd1681_glyph_row_bits(glyph_row, font_size, bits);
+            ssd1681_line_or_bits(line, x + (int32_t)i * font_size, bits, font_size);
+        }
+
+        uint8_t *dst = gram + GRAM_ROW(py) * BYTES_PER_ROW;
+        for (int32_t b = left / 8; b <= right / 8; b++) {
+            uint8_t mask = 0xFF;
+            if (b == left / 8) mask &= first_mask;
+            if (b == right / 8) mask &= last_mask;
+
+            /* Planes are active-low: clearing a bit inks the pixel */
+            if (opaque) {
+                dst[b] = (dst[b] & ~mask) | (~line[b] & mask);
+            } else if (ink) {
+                dst[b] &= ~(line[b] & mask);
+            } else {
+                dst[b] |= line[b] & mask;
+            }
+        }
+    }
+}
+
 /**
  * @brief Draw string (simplified - needs font data)
  */
-int ssd1681_draw_string(ssd1681_color_t color, uint8_t x, uint8_t y,
+int ssd1681_draw_string(ssd1681_color_t color, uint16_t x, uint16_t y,
                         const char *str, uint16_t len, uint8_t data,
                         uint8_t font_size)
 {
@@ -623,17 +1126,17 @@ int ssd1681_draw_string(ssd1681_color_t color, uint8_t x, uint8_t y,
     if (!str) return -2;
 
 
+    uint8_t *gram = ssd1681_get_gram(color);
+    if (!gram) return -1;
+    if (font_size == 0) return 0;
+
+    static const ssd1681_rect_t screen = {0, 0, DISPLAY_WIDTH - 1, DISPLAY_HEIGHT - 1};
+    (void)data;  /* Cells are drawn opaque, as before */
+
     for(uint16_t i = 0; i < len; i++) {
-        char c = str[i];
-        if (c > 127) continue;  /* Skip unsupported characters */
-        
-        const char *char_bitmap = font_basic_8x8[(uint8_t)c];
-        
-        for(uint8_t row = 0; row < font_size; row++) {
-            for (uint8_t col = 0; col < font_size; col++) {
-                ssd1681_write_point(color, x+col, y+row, char_bitmap[(row*FONT_BASIC_SIZE)/font_size] & ( 1 << ((col*FONT_BASIC_SIZE/font_size))));
-            }
-        }
+        if ((uint8_t)str[i] > 127) continue;  /* Skip unsupported characters */
+
+        ssd1681_text_run(gram, x, y, &str[i], 1, font_size, &screen, true, true);
 
         x += font_size;  /* Move to next character position */
         if (x + font_size > DISPLAY_WIDTH) {
@@ -645,42 +1148,230 @@ int ssd1681_draw_string(ssd1681_color_t color, uint8_t x, uint8_t y,
         }
     }
 
-    
     return 0;
 }
 
 /**
- * @brief Fill rectangle
+ * @brief Draw one line of text at an origin that may lie off the panel
  */
-int ssd1681_fill_rect(ssd1681_color_t color, uint8_t left, uint8_t top,
-                      uint8_t right, uint8_t bottom, uint8_t data)
+int ssd1681_draw_text_at(ssd1681_color_t color, int16_t x, int16_t y,
+                         const char *str, uint16_t len, uint8_t data, uint8_t font_size)
 {
     if (!g_ssd1681.initialized) return -1;
-    if (left >= DISPLAY_WIDTH || top >= DISPLAY_HEIGHT) return -2;
-    if (right >= DISPLAY_WIDTH || bottom >= DISPLAY_HEIGHT) return -3;
-    if (left > right || top > bottom) return -4;
-    
-    for (uint8_t y = top; y <= bottom; y++) {
-        for (uint8_t x = left; x <= right; x++) {
-            ssd1681_write_point(color, x, y, data);
-        }
+    if (!str) return -2;
+    if (font_size == 0) return -4;
+
+    uint8_t *gram = ssd1681_get_gram(color);
+    if (!gram) return -1;
+
+    static const ssd1681_rect_t screen = {0, 0, DISPLAY_WIDTH - 1, DISPLAY_HEIGHT - 1};
+
+    if (y >= DISPLAY_HEIGHT || y + font_size <= 0) return 0;
+
+    /* Only render the characters that can touch the panel */
+    uint16_t skip = 0;
+    if (x + font_size <= 0) {
+        skip = (uint16_t)((-x) / font_size);
+        if (skip >= len) return 0;
     }
-    
+
+    int32_t left = (int32_t)x + (int32_t)skip * font_size;
+    if (left >= DISPLAY_WIDTH) return 0;
+
+    uint16_t n = len - skip;
+    uint16_t fit = (uint16_t)((DISPLAY_WIDTH - left + font_size - 1) / font_size);
+    if (n > fit) n = fit;
+
+    ssd1681_text_run(gram, left, y, &str[skip], n, font_size, &screen, data, false);
+
     return 0;
 }
 
 /**
- * @brief Draw picture
+ * @brief Find the end of the line starting at start
+ * @param max_chars Characters that fit on a line, 0 for no wrapping
+ * @param line_len Output: characters to draw, trailing spaces removed
+ * @return Index where the next line starts
  */
-int ssd1681_draw_picture(ssd1681_color_t color, uint8_t left, uint8_t top,
-                         uint8_t right, uint8_t bottom, const uint8_t *img)
+static uint16_t ssd1681_text_next_line(const char *str, uint16_t len, uint16_t start,
+                                       uint16_t max_chars, uint16_t *line_len)
 {
-    if (!g_ssd1681.initialized) return -1;
+    uint16_t i = start;
+    uint16_t last_space = start;  /* start means no break opportunity yet */
+    uint16_t end;
+    uint16_t next;
+
+    while (i < len && str[i] != '\n') {
+        if (max_chars && i - start == max_chars) break;
+        if (str[i] == ' ') last_space = i;
+        i++;
+    }
+
+    if (i >= len) {
+        end = next = len;
+    } else if (str[i] == '\n') {
+        end = i;
+        next = i + 1;
+    } else if (str[i] == ' ' || last_space == start) {
+        end = next = i;  /* Break at a space or hard-break an over-long word */
+    } else {
+        end = next = last_space;
+    }
+
+    /* Spaces at a wrap point are consumed by the break */
+    if (next == end) {
+        while (next < len && str[next] == ' ') next++;
+    }
+    while (end > start && str[end - 1] == ' ') end--;
+
+    *line_len = end - start;
+    return next;
+}
+
+/**
+ * @brief Measure text extents
+ */
+int ssd1681_measure_text(const char *str, uint16_t len, uint8_t font_size, uint16_t max_width,
+                         uint16_t *width, uint16_t *height)
+{
+    if (!str) return -2;
+    if (font_size == 0) return -4;
+
+    uint16_t max_chars = max_width ? ((max_width / font_size) ? max_width / font_size : 1) : 0;
+    uint16_t widest = 0;
+    uint16_t lines = 0;
+    uint16_t i = 0;
+
+    do {
+        uint16_t line_len;
+        i = ssd1681_text_next_line(str, len, i, max_chars, &line_len);
+        if (line_len > widest) widest = line_len;
+        lines++;
+    } while (i < len);
+
+    if (width) *width = widest * font_size;
+    if (height) *height = lines * font_size;
+
+    return 0;
+}
+
+/**
+ * @brief Draw text inside a box
+ */
+int ssd1681_draw_text(ssd1681_color_t color, const ssd1681_rect_t *box,
+                      const char *str, uint16_t len, uint8_t data,
+                      uint8_t font_size, ssd1681_align_t align, bool wrap)
+{
+    if (!g_ssd1681.initialized) return -1;
+    if (!str || !box) return -2;
+    if (box->left > box->right || box->top > box->bottom) return -3;
+    if (box->right >= DISPLAY_WIDTH || box->bottom >= DISPLAY_HEIGHT) return -3;
+    if (font_size == 0) return -4;
+
+    uint8_t *gram = ssd1681_get_gram(color);
+    if (!gram) return -1;
+
+    const uint16_t box_width = box->right - box->left + 1;
+    uint16_t max_chars = 0;
+    if (wrap) {
+        max_chars = (box_width / font_size) ? box_width / font_size : 1;
+    }
+
+    uint16_t i = 0;
+    for (uint32_t y = box->top; i < len && y <= box->bottom; y += font_size) {
+        uint16_t line_len;
+        uint16_t start = i;
+        i = ssd1681_text_next_line(str, len, i, max_chars, &line_len);
+
+        int32_t x = box->left;
+        int32_t slack = (int32_t)box_width - (int32_t)line_len * font_size;
+        if (align == SSD1681_ALIGN_CENTER) {
+            x += slack / 2;
+        } else if (align == SSD1681_ALIGN_RIGHT) {
+            x += slack;
+        }
+
+        ssd1681_text_run(gram, x, y, &str[start], line_len, font_size, box, data, false);
+    }
+
+    return 0;
+}
+
+/**
+ * @brief Fill rectangle
+ */
+int ssd1681_fill_rect(ssd1681_color_t color, uint16_t left, uint16_t top,
+                      uint16_t right, uint16_t bottom, uint8_t data)
+{
+    if (!g_ssd1681.initialized) return -1;
+    if (left >= DISPLAY_WIDTH || top >= DISPLAY_HEIGHT) return -2;
+    if (right >= DISPLAY_WIDTH || bottom >= DISPLAY_HEIGHT) return -3;
+    if (left > right || top > bottom) return -4;
+    
+    uint8_t *gram = ssd1681_get_gram(color);
+    if (!gram) return -1;
+    
+    for (uint16_t y = top; y <= bottom; y++) {
+        ssd1681_row_fill(gram + (uint32_t)GRAM_ROW(y) * BYTES_PER_ROW, left, right, data ? 0x00 : 0xFF);
+    }
+    
+    return 0;
+}
+
+const uint8_t ssd1681_pattern_solid[8]    = {0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF};
+const uint8_t ssd1681_pattern_checker[8]  = {0xAA, 0x55, 0xAA, 0x55, 0xAA, 0x55, 0xAA, 0x55};
+const uint8_t ssd1681_pattern_gray25[8]   = {0x88, 0x00, 0x22, 0x00, 0x88, 0x00, 0x22, 0x00};
+const uint8_t ssd1681_pattern_gray75[8]   = {0x77, 0xFF, 0xDD, 0xFF, 0x77, 0xFF, 0xDD, 0xFF};
+const uint8_t ssd1681_pattern_diagonal[8] = {0x01, 0x02, 0x04, 0x08, 0x10, 0x20, 0x40, 0x80};
+const uint8_t ssd1681_pattern_hlines[8]   = {0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00};
+const uint8_t ssd1681_pattern_vlines[8]   = {0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA};
+
+/**
+ * @brief Combine an 8x8 pattern with a rectangle of a plane
+ */
+int ssd1681_fill_pattern(ssd1681_color_t color, uint16_t left, uint16_t top, uint16_t right, uint16_t bottom,
+                         const uint8_t pattern[8], ssd1681_rop_t rop)
+{
+    if (!g_ssd1681.initialized) return -1;
+    if (left >= DISPLAY_WIDTH || top >= DISPLAY_HEIGHT) return -2;
+    if (right >= DISPLAY_WIDTH || bottom >= DISPLAY_HEIGHT) return -3;
+    if (left > right || top > bottom) return -4;
+    if (!pattern || rop > SSD1681_ROP_XOR) return -5;
+
+    uint8_t *gram = ssd1681_get_gram(color);
+    if (!gram) return -1;
+
+    /* Byte columns start at multiples of 8, so a pattern row is already aligned to every byte */
+    for (uint16_t y = top; y <= bottom; y++) {
+        ssd1681_row_rop(gram + (uint32_t)GRAM_ROW(y) * BYTES_PER_ROW, left, right, pattern[y % 8], rop);
+    }
+
+    return 0;
+}
+
+/**
+ * @brief Invert a rectangle of a plane in place
+ */
+int ssd1681_invert_rect(ssd1681_color_t color, uint16_t left, uint16_t top, uint16_t right, uint16_t bottom)
+{
+    return ssd1681_fill_pattern(color, left, top, right, bottom, ssd1681_pattern_solid, SSD1681_ROP_XOR);
+}
+
+/**
+ * @brief Draw picture
+ */
+int ssd1681_draw_picture(ssd1681_color_t color, uint16_t left, uint16_t top,
+                         uint16_t right, uint16_t bottom, const uint8_t *img)
+{
+    if (!g_ssd1681.initialized) return -1;
     if (!img) return -2;
     if (left >= DISPLAY_WIDTH || top >= DISPLAY_HEIGHT) return -3;
     if (right >= DISPLAY_WIDTH || bottom >= DISPLAY_HEIGHT) return -4;
     if (left > right || top > bottom) return -5;
     
+    uint8_t *gram = ssd1681_get_gram(color);
+    if (!gram) return -1;
+    
     uint16_t width = right - left + 1;
     uint16_t height = bottom - top + 1;
     uint16_t bytes_per_line = (width + 7) / 8;
@@ -690,9 +1381,713 @@ int ssd1681_draw_picture(ssd1681_color_t color, uint8_t left, uint8_t top,
             uint16_t img_byte = y * bytes_per_line + (x / 8);
             uint8_t img_bit = 7 - (x % 8);
             uint8_t pixel = (img[img_byte] & (1 << img_bit)) ? 1 : 0;
-            ssd1681_write_point(color, left + x, top + y, pixel);
+            ssd1681_gram_put(gram, left + x, top + y, pixel);
         }
     }
     
     return 0;
 }
+
+/**
+ * @brief Write a point on both planes
+ */
+int ssd1681_write_point_tri(uint16_t x, uint16_t y, ssd1681_tricolor_t color)
+{
+    if (!g_ssd1681.initialized) return -1;
+    if (x >= DISPLAY_WIDTH || y >= DISPLAY_HEIGHT) return -2;
+
+    uint8_t *black, *red;
+    uint8_t black_value, red_value;
+    int ret = ssd1681_tri_planes(color, &black, &red, &black_value, &red_value);
+    if (ret != 0) return ret;
+
+    const uint16_t i = GRAM_INDEX(x, y);
+    const uint8_t bit = GRAM_BIT(x);
+    black[i] = (black[i] & ~bit) | (black_value & bit);
+    if (red) red[i] = (red[i] & ~bit) | (red_value & bit);
+
+    return 0;
+}
+
+/**
+ * @brief Read a point from both planes
+ */
+int ssd1681_read_point_tri(uint16_t x, uint16_t y, ssd1681_tricolor_t *color)
+{
+    if (!g_ssd1681.initialized) return -1;
+    if (x >= DISPLAY_WIDTH || y >= DISPLAY_HEIGHT) return -2;
+    if (!color) return -3;
+
+    const uint8_t *black = ssd1681_get_gram(SSD1681_COLOR_BLACK);
+    const uint8_t *red = ssd1681_get_gram(SSD1681_COLOR_RED);
+    if (!black) return -1;
+
+    const uint16_t i = GRAM_INDEX(x, y);
+    if (red && !(red[i] & GRAM_BIT(x))) {
+        *color = SSD1681_TRI_RED;
+    } else {
+        *color = (black[i] & GRAM_BIT(x)) ? SSD1681_TRI_WHITE : SSD1681_TRI_BLACK;
+    }
+
+    return 0;
+}
+
+/**
+ * @brief Fill a rectangle on both planes in one pass
+ */
+int ssd1681_fill_rect_tri(uint16_t left, uint16_t top, uint16_t right, uint16_t bottom,
+                          ssd1681_tricolor_t color)
+{
+    if (!g_ssd1681.initialized) return -1;
+    if (left >= DISPLAY_WIDTH || top >= DISPLAY_HEIGHT) return -2;
+    if (right >= DISPLAY_WIDTH || bottom >= DISPLAY_HEIGHT) return -3;
+    if (left > right || top > bottom) return -4;
+
+    uint8_t *black, *red;
+    uint8_t black_value, red_value;
+    int ret = ssd1681_tri_planes(color, &black, &red, &black_value, &red_value);
+    if (ret != 0) return ret;
+
+    for (uint16_t y = top; y <= bottom; y++) {
+        const uint32_t row = (uint32_t)GRAM_ROW(y) * BYTES_PER_ROW;
+        ssd1681_row_fill(black + row, left, right, black_value);
+        if (red) ssd1681_row_fill(red + row, left, right, red_value);
+    }
+
+    return 0;
+}
+
+/**
+ * @brief Draw a 1bpp image on both planes in one pass
+ */
+int ssd1681_draw_picture_tri(uint16_t left, uint16_t top, uint16_t right, uint16_t bottom,
+                             const uint8_t *img, ssd1681_tricolor_t color)
+{
+    if (!g_ssd1681.initialized) return -1;
+    if (!img) return -2;
+    if (left >= DISPLAY_WIDTH || top >= DISPLAY_HEIGHT) return -3;
+    if (right >= DISPLAY_WIDTH || bottom >= DISPLAY_HEIGHT) return -4;
+    if (left > right || top > bottom) return -5;
+
+    uint8_t *black, *red;
+    uint8_t black_value, red_value;
+    int ret = ssd1681_tri_planes(color, &black, &red, &black_value, &red_value);
+    if (ret != 0) return ret;
+
+    const uint16_t width = right - left + 1;
+    const uint16_t bytes_per_line = (width + 7) / 8;
+
+    for (uint16_t y = top; y <= bottom; y++) {
+        const uint8_t *src = img + (uint32_t)(y - top) * bytes_per_line;
+        const uint32_t row = (uint32_t)GRAM_ROW(y) * BYTES_PER_ROW;
+
+        /* Gather up to 8 source bits per destination byte, then write both planes once */
+        for (uint16_t x = left; x <= right; ) {
+            const uint16_t byte = x / 8;
+            uint8_t mask = 0;
+            uint8_t ink = 0;
+            for (; x <= right && x / 8 == byte; x++) {
+                const uint16_t ix = x - left;
+                mask |= GRAM_BIT(x);
+                if (src[ix / 8] & (0x80 >> (ix % 8))) ink |= GRAM_BIT(x);
+            }
+
+            /* Set bits take color, clear bits become white on both planes */
+            uint8_t *b = &black[row + byte];
+            *b = (*b & ~mask) | (mask & ~(ink & ~black_value));
+            if (red) {
+                uint8_t *r = &red[row + byte];
+                *r = (*r & ~mask) | (mask & ~(ink & ~red_value));
+            }
+        }
+    }
+
+    return 0;
+}
+
+/**
+ * @brief Expand run-length tokens into rows of a buffer
+ */
+int ssd1681_rle_decode(uint8_t *dst, uint16_t width, uint16_t pitch, uint32_t total,
+                       const uint8_t *src, uint32_t len)
+{
+    if (!dst || !src || width == 0) return -2;
+
+    /* Runs are split at row ends so a strided destination gets whole rows */
+    const uint8_t *end = src + len;
+    uint32_t out = 0;
+    uint16_t col = 0;
+    uint8_t *row = dst;
+
+    while (src < end && out < total) {
+        const uint8_t c = *src++;
+        uint16_t n = (c & 0x7F) + 1;
+        const bool repeat = c & 0x80;
+        if (repeat ? (src >= end) : ((uint32_t)(end - src) < n)) return -5;
+        if (out + n > total) return -5;
+
+        while (n) {
+            uint16_t chunk = width - col;
+            if (chunk > n) chunk = n;
+            if (repeat) {
+                memset(row + col, *src, chunk);
+            } else {
+                memcpy(row + col, src, chunk);
+                src += chunk;
+            }
+            col += chunk;
+            out += chunk;
+            n -= chunk;
+            if (col == width) {
+                col = 0;
+                row += pitch;
+            }
+        }
+        if (repeat) src++;
+    }
+
+    return (out == total) ? 0 : -5;
+}
+
+/**
+ * @brief Check that an asset fits at left/top
+ */
+static int ssd1681_asset_check(uint16_t left, uint16_t top, const ssd1681_asset_t *asset)
+{
+    if (!asset || !asset->data) return -2;
+    if (left % 8) return -3;
+    if (asset->width == 0 || asset->height == 0 || asset->stride != (asset->width + 7) / 8) return -5;
+    if (left / 8 + asset->stride > BYTES_PER_ROW || top + asset->height > DISPLAY_HEIGHT) return -4;
+    return 0;
+}
+
+/**
+ * @brief Copy a native-layout asset into a plane
+ */
+int ssd1681_draw_asset(ssd1681_color_t color, uint16_t left, uint16_t top, const ssd1681_asset_t *asset)
+{
+    if (!g_ssd1681.initialized) return -1;
+
+    int ret = ssd1681_asset_check(left, top, asset);
+    if (ret != 0) return ret;
+
+    uint8_t *gram = ssd1681_get_gram(color);
+    if (!gram) return -1;
+
+    /* Asset row 0 is its bottom row; both are bottom-up so rows land in increasing plane order */
+    const uint32_t total = (uint32_t)asset->stride * asset->height;
+    uint8_t *dst = gram + (uint32_t)GRAM_ROW(top + asset->height - 1) * BYTES_PER_ROW + left / 8;
+
+    if (asset->encoding == SSD1681_ASSET_RAW) {
+        if (asset->size != total) return -5;
+        if (asset->stride == BYTES_PER_ROW) {
+            memcpy(dst, asset->data, total);
+        } else {
+            for (uint16_t r = 0; r < asset->height; r++) {
+                memcpy(dst + (uint32_t)r * BYTES_PER_ROW, asset->data + (uint32_t)r * asset->stride, asset->stride);
+            }
+        }
+        return 0;
+    }
+
+    if (asset->encoding != SSD1681_ASSET_RLE) return -5;
+
+    return ssd1681_rle_decode(dst, asset->stride, BYTES_PER_ROW, total, asset->data, asset->size);
+}
+
+/**
+ * @brief Send a raw asset straight to the controller RAM window
+ */
+int ssd1681_write_asset(ssd1681_color_t color, uint16_t left, uint16_t top, const ssd1681_asset_t *asset)
+{
+    if (!g_ssd1681.initialized) return -1;
+
+    int ret = ssd1681_asset_check(left, top, asset);
+    if (ret != 0) return ret;
+    if (asset->encoding != SSD1681_ASSET_RAW) return -6;
+    if (asset->size != (uint32_t)asset->stride * asset->height) return -5;
+
+    /* write_region walks rows bottom to top from the top row pointer: start at the last asset row */
+    const int16_t stride = (int16_t)asset->stride;
+    return ssd1681_write_region(color, left, top, left + asset->stride * 8 - 1, top + asset->height - 1,
+                                asset->data + (uint32_t)(asset->height - 1) * asset->stride, -stride);
+}
+
+/*
+ * 4-level waveform. The (BW, RED) RAM bit pair of each pixel selects one of the VS groups
+ * L0..L3, each driving the particles for a different time: 00 white, 10 light, 01 dark, 11 black.
+ */
+const uint8_t ssd1681_gray4_lut[SSD1681_GRAY_LUT_SIZE] = {
+    0x00, 0x60, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  /* VS L0 */
+    0x20, 0x60, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  /* VS L1 */
+    0x28, 0x60, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  /* VS L2 */
+    0x2A, 0x60, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  /* VS L3 */
+    0x00, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  /* VS L4 (VCOM) */
+    0x00, 0x02, 0x00, 0x05, 0x14, 0x00, 0x00,  /* TP/SR/RP group 0 */
+    0x1E, 0x1E, 0x00, 0x00, 0x00, 0x00, 0x01,  /* group 1 */
+    0x00, 0x02, 0x00, 0x05, 0x14, 0x00, 0x00,  /* group 2 */
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,  /* group 11 */
+    0x22, 0x22, 0x22, 0x22, 0x22, 0x22,        /* Frame rate */
+    0x00, 0x00, 0x00,                          /* XON */
+    0x22,                                      /* EOPT */
+    0x17,                                      /* VGH */
+    0x41, 0xAE, 0x32,                          /* VSH1, VSH2, VSL */
+    0x28,                                      /* VCOM */
+};
+
+/**
+ * @brief Stream one level bit of a 2bpp image into a controller RAM, rows bottom-up
+ * @param bit 0 for the BW RAM (level bit 0), 1 for the RED RAM (level bit 1)
+ */
+static void ssd1681_gray_write_ram(const uint8_t *img, uint8_t bit)
+{
+    const uint16_t src_stride = DISPLAY_WIDTH / 4;
+    uint8_t line[BYTES_PER_ROW];
+
+    ssd1681_write_cmd(bit ? CMD_WRITE_RAM_RED : CMD_WRITE_RAM_BW);
+    for (int32_t y = DISPLAY_HEIGHT - 1; y >= 0; y--) {
+        const uint8_t *src = img + (uint32_t)y * src_stride;
+        for (uint16_t b = 0; b < BYTES_PER_ROW; b++) {
+            /* Two source bytes hold the 8 pixels of one RAM byte; a set RAM bit is the darker half */
+            uint16_t px = ((uint16_t)src[2 * b] << 8) | src[2 * b + 1];
+            uint8_t out = 0;
+            for (uint8_t i = 0; i < 8; i++) {
+                uint8_t level = (px >> (14 - 2 * i)) & 0x03;
+                if (!((level >> bit) & 1)) out |= 0x80 >> i;
+            }
+            line[b] = out;
+        }
+        ssd1681_write_data_buf(line, BYTES_PER_ROW);
+    }
+}
+
+/**
+ * @brief Show a 4-level grayscale image in a single refresh
+ */
+int ssd1681_show_gray(const uint8_t *img, const uint8_t *lut)
+{
+    if (!g_ssd1681.initialized) return -1;
+    if (!img) return -2;
+    if (!lut) lut = ssd1681_gray4_lut;
+
+    ssd1681_wait_busy();
+
+    ssd1681_set_window(0, 0, DISPLAY_WIDTH - 1, DISPLAY_HEIGHT - 1);
+    ssd1681_set_cursor(0, 0);
+    ssd1681_gray_write_ram(img, 0);
+    ssd1681_set_cursor(0, 0);
+    ssd1681_gray_write_ram(img, 1);
+
+    /* Waveform and its voltages */
+    ssd1681_write_cmd(CMD_WRITE_LUT_REGISTER);
+    ssd1681_write_data_buf(lut, GRAY_LUT_WAVEFORM_BYTES);
+    ssd1681_write_cmd(CMD_END_OPTION);
+    ssd1681_write_data(lut[GRAY_LUT_WAVEFORM_BYTES]);
+    ssd1681_write_cmd(CMD_GATE_DRIVING_VOLTAGE);
+    ssd1681_write_data(lut[GRAY_LUT_WAVEFORM_BYTES + 1]);
+    ssd1681_write_cmd(CMD_SOURCE_DRIVING_VOLTAGE);
+    ssd1681_write_data_buf(&lut[GRAY_LUT_WAVEFORM_BYTES + 2], 3);
+    ssd1681_write_cmd(CMD_VCOM_REGISTER);
+    ssd1681_write_data(lut[GRAY_LUT_WAVEFORM_BYTES + 5]);
+
+    /* Both RAMs used as written (0x00), same source output range as the other updates (0x80);
+     * display with the register LUT */
+    ssd1681_write_cmd(CMD_DISPLAY_UPDATE_CONTROL);
+    ssd1681_write_data(0x00);
+    ssd1681_write_data(0x80);
+    ssd1681_write_cmd(CMD_DISPLAY_UPDATE_CONTROL_2);
+    ssd1681_write_data(UPDATE_SEQ_REGISTER_LUT);
+    ssd1681_write_cmd(CMD_MASTER_ACTIVATION);
+
+    g_ssd1681.gray_shown = true;
+    return 0;
+}
+
+/**
+ * @brief Start a row-streamed dither
+ */
+int ssd1681_dither_begin(ssd1681_dither_mode_t mode, ssd1681_pixel_format_t format,
+                         uint16_t left, uint16_t top, uint16_t width, uint16_t height)
+{
+    if (!g_ssd1681.initialized) return -1;
+    if (mode > SSD1681_DITHER_FLOYD_STEINBERG || format > SSD1681_PIXEL_RGB888) return -2;
+    if (width == 0 || height == 0) return -3;
+    if (left + width > DISPLAY_WIDTH || top + height > DISPLAY_HEIGHT) return -3;
+    if (!g_ssd1681.black_gram) return -1;
+
+    g_dither.mode = mode;
+    g_dither.format = format;
+    g_dither.left = left;
+    g_dither.top = top;
+    g_dither.width = width;
+    g_dither.height = height;
+    g_dither.row = 0;
+    memset(g_dither.err_luma, 0, sizeof(g_dither.err_luma));
+    memset(g_dither.err_red, 0, sizeof(g_dither.err_red));
+    g_dither.active = true;
+
+    return 0;
+}
+
+/**
+ * @brief Spread a quantization error to the neighbours of pixel i (error buffers are offset by one)
+ */
+static inline void ssd1681_dither_diffuse(int16_t *cur, int16_t *next, int i, int dir, int16_t err)
+{
+    cur[i + 1 + dir] += (err * 7) >> 4;
+    next[i + 1 - dir] += (err * 3) >> 4;
+    next[i + 1] += (err * 5) >> 4;
+    next[i + 1 + dir] += err >> 4;
+}
+
+/**
+ * @brief Dither one row into the framebuffer planes
+ */
+int ssd1681_dither_row(const uint8_t *row)
+{
+    if (!g_ssd1681.initialized) return -1;
+    if (!row) return -2;
+    if (!g_dither.active) return -3;
+
+    const bool rgb = (g_dither.format == SSD1681_PIXEL_RGB888);
+    uint8_t *red_plane = ssd1681_get_gram(SSD1681_COLOR_RED);
+    const bool extract_red = rgb && red_plane;  /* Without a red plane, red is dithered as luma */
+    const bool diffuse = (g_dither.mode == SSD1681_DITHER_FLOYD_STEINBERG);
+    const uint16_t y = g_dither.top + g_dither.row;
+
+    uint8_t *black_row = g_ssd1681.black_gram[GRAM_ROW(y)];
+    uint8_t *red_row = extract_red ? red_plane + GRAM_ROW(y) * BYTES_PER_ROW : NULL;
+
+    int16_t *cur_luma = g_dither.err_luma[g_dither.row & 1];
+    int16_t *next_luma = g_dither.err_luma[(g_dither.row + 1) & 1];
+    int16_t *cur_red = g_dither.err_red[g_dither.row & 1];
+    int16_t *next_red = g_dither.err_red[(g_dither.row + 1) & 1];
+
+    /* Serpentine scan: odd rows run right to left to avoid directional artifacts */
+    const int dir = (diffuse && (g_dither.row & 1)) ? -1 : 1;
+    int i = (dir > 0) ? 0 : g_dither.width - 1;
+
+    for (uint16_t n = 0; n < g_dither.width; n++, i += dir) {
+        const uint8_t *px = rgb ? &row[i * 3] : &row[i];
+        int16_t luma;
+        int16_t redness = 0;
+
+        if (rgb) {
+            uint8_t max_gb = (px[1] > px[2]) ? px[1] : px[2];
+            luma = (77 * px[0] + 150 * px[1] + 29 * px[2]) >> 8;
+            redness = (px[0] > max_gb) ? (px[0] - max_gb) : 0;
+        } else {
+            luma = px[0];
+        }
+
+        int16_t threshold = DITHER_THRESHOLD;
+        if (diffuse) {
+            luma += cur_luma[i + 1];
+            redness += cur_red[i + 1];
+        } else if (g_dither.mode == SSD1681_DITHER_ORDERED) {
+            threshold = bayer_4x4[y & 3][(g_dither.left + i) & 3] * 16 + 8;
+        }
+
+        const bool red = extract_red && (redness >= threshold);
+        const bool black = !red && (luma < threshold);
+
+        if (diffuse) {
+            int16_t luma_level = red ? DITHER_RED_LUMA : (black ? 0 : 255);
+            ssd1681_dither_diffuse(cur_luma, next_luma, i, dir, luma - luma_level);
+            if (extract_red) {
+                ssd1681_dither_diffuse(cur_red, next_red, i, dir, redness - (red ? 255 : 0));
+            }
+        }
+
+        /* Planes are active-low: a cleared bit is an inked pixel */
+        const uint16_t x = g_dither.left + i;
+        const uint8_t mask = GRAM_BIT(x);
+        if (black) {
+            black_row[x / 8] &= ~mask;
+        } else {
+            black_row[x / 8] |= mask;
+        }
+        if (extract_red) {
+            if (red) {
+                red_row[x / 8] &= ~mask;
+            } else {
+                red_row[x / 8] |= mask;
+            }
+        }
+    }
+
+    if (diffuse) {
+        /* The current row buffer becomes the row after next */
+        memset(cur_luma, 0, sizeof(g_dither.err_luma[0]));
+        memset(cur_red, 0, sizeof(g_dither.err_red[0]));
+    }
+
+    if (++g_dither.row >= g_dither.height) {
+        g_dither.active = false;
+    }
+
+    return 0;
+}
+
+/**
+ * @brief Attach application-owned planes
+ */
+int ssd1681_set_framebuffers(uint8_t *black, uint8_t *red)
+{
+    if (!g_ssd1681.initialized) return -1;
+
+#ifndef SSD1681_EXTERNAL_FRAMEBUFFER
+    if (!black) black = &g_ssd1681.black_buf[0][0];
+#if HAS_RED_PLANE
+    if (!red) red = &g_ssd1681.red_buf[0][0];
+#endif
+#endif
+#if !HAS_RED_PLANE
+    red = NULL;  /* Monochrome build: the red argument is ignored */
+#endif
+
+    g_ssd1681.black_gram = (uint8_t (*)[BYTES_PER_ROW])black;
+    g_ssd1681.red_gram = (uint8_t (*)[BYTES_PER_ROW])red;
+    g_dither.active = false;  /* Rows in flight targeted the old planes */
+
+    return 0;
+}
+
+/**
+ * @brief Get the active plane
+ */
+uint8_t *ssd1681_get_framebuffer(ssd1681_color_t color)
+{
+    if (!g_ssd1681.initialized) return NULL;
+
+    return ssd1681_get_gram(color);
+}
+
+/**
+ * @brief Write a region to display RAM straight from a caller buffer
+ */
+int ssd1681_write_region(ssd1681_color_t color, uint16_t left, uint16_t top,
+                         uint16_t right, uint16_t bottom, const uint8_t *src, int16_t stride)
+{
+    if (!g_ssd1681.initialized) return -1;
+    if (!src) return -2;
+    if (left >= DISPLAY_WIDTH || top >= DISPLAY_HEIGHT) return -3;
+    if (right >= DISPLAY_WIDTH || bottom >= DISPLAY_HEIGHT) return -4;
+    if (left > right || top > bottom) return -5;
+
+    const uint16_t row_bytes = right / 8 - left / 8 + 1;
+
+    ssd1681_wait_busy();
+
+    /*
+     * Full-height Y window so the decrementing Y counter wraps exactly as it does
+     * for a full plane upload; rows are therefore sent bottom-up, like the plane.
+     */
+    ssd1681_set_window(left, 0, right, DISPLAY_HEIGHT - 1);
+    ssd1681_set_cursor(left, (GRAM_ROW(bottom) == 0) ? 0 : DISPLAY_HEIGHT - GRAM_ROW(bottom));
+
+    ssd1681_write_cmd((color == SSD1681_COLOR_BLACK) ? CMD_WRITE_RAM_BW : CMD_WRITE_RAM_RED);
+    for (int32_t y = bottom; y >= top; y--) {
+        ssd1681_write_data_buf(src + (int32_t)(y - top) * stride, row_bytes);
+    }
+
+    return 0;
+}
+
+/**
+ * @brief Write a region of the active plane to display RAM
+ */
+int ssd1681_write_buffer_region(ssd1681_color_t color, uint16_t left, uint16_t top,
+                                uint16_t right, uint16_t bottom)
+{
+    if (!g_ssd1681.initialized) return -1;
+
+    uint8_t *gram = ssd1681_get_gram(color);
+    if (!gram) return -1;
+
+    /* Same checks as ssd1681_write_region(), before the plane pointer is formed */
+    if (left >= DISPLAY_WIDTH || top >= DISPLAY_HEIGHT) return -3;
+    if (right >= DISPLAY_WIDTH || bottom >= DISPLAY_HEIGHT) return -4;
+    if (left > right || top > bottom) return -5;
+
+    return ssd1681_write_region(color, left, top, right, bottom,
+                                gram + GRAM_INDEX(left, top), -BYTES_PER_ROW);
+}
+
+/**
+ * @brief Rank update types by how thorough they are, so coalescing never weakens a refresh
+ */
+static uint8_t ssd1681_update_rank(uint8_t update_type)
+{
+    switch (update_type) {
+        case SSD1681_UPDATE_FAST_PARTIAL: return 0;
+        case SSD1681_UPDATE_FAST_FULL: return 1;
+        case SSD1681_UPDATE_CLEAN_FULL: return 2;
+        default: return 3;
+    }
+}
+
+/**
+ * @brief Submit the current framebuffer contents for display
+ */
+int ssd1681_submit_frame(uint8_t update_type)
+{
+    if (!g_ssd1681.initialized) return -1;
+    if (update_type > SSD1681_UPDATE_CLEAN_FULL_AGGRESSIVE) return -2;
+
+    if (g_frame_queue.pending) {
+        g_frame_queue.coalesced++;
+        if (ssd1681_update_rank(update_type) < ssd1681_update_rank(g_frame_queue.update_type)) {
+            update_type = g_frame_queue.update_type;
+        }
+    }
+
+    g_frame_queue.update_type = update_type;
+    g_frame_queue.pending = true;
+
+    return 0;
+}
+
+/**
+ * @brief Push the pending frame to the panel when it is free
+ */
+int ssd1681_service_frames(void)
+{
+    if (!g_ssd1681.initialized) return -1;
+    if (!g_frame_queue.pending) return 0;
+
+    uint64_t now = time_us_64();
+    if (g_frame_queue.refreshed && now - g_frame_queue.last_refresh_us < g_frame_queue.min_interval_us) {
+        return 2;  /* Rate limited */
+    }
+
+    /* Blocks for FAST_FULL and CLEAN_FULL_AGGRESSIVE, which wait between their passes */
+    if (ssd1681_write_buffer_and_update_if_ready(g_frame_queue.update_type) != 0) {
+        return 2;  /* Panel busy */
+    }
+
+    g_frame_queue.pending = false;
+    g_frame_queue.refreshed = true;
+    g_frame_queue.last_refresh_us = now;
+
+    return 1;
+}
+
+/**
+ * @brief Set the minimum time between two refreshes started by the queue
+ */
+void ssd1681_set_min_refresh_interval(uint32_t interval_ms)
+{
+    g_frame_queue.min_interval_us = (uint64_t)interval_ms * 1000;
+}
+
+/**
+ * @brief Check for a frame waiting for the panel
+ */
+bool ssd1681_frame_pending(void)
+{
+    return g_frame_queue.pending;
+}
+
+/**
+ * @brief Number of frames replaced by newer ones before being shown
+ */
+uint32_t ssd1681_frames_coalesced(void)
+{
+    return g_frame_queue.coalesced;
+}
+
+/**
+ * @brief Start recording bus activity
+ */
+int ssd1681_trace_start(void)
+{
+#ifdef SSD1681_TRACE
+    memset(&g_trace, 0, sizeof(g_trace));
+    g_trace.enabled = true;
+    return 0;
+#else
+    return -1;
+#endif
+}
+
+/**
+ * @brief Stop recording, the captured events are kept
+ */
+void ssd1681_trace_stop(void)
+{
+#ifdef SSD1681_TRACE
+    g_trace.enabled = false;
+    g_trace.data_open = false;
+#endif
+}
+
+/**
+ * @brief Number of events held in the ring buffer
+ */
+uint32_t ssd1681_trace_count(void)
+{
+#ifdef SSD1681_TRACE
+    return (g_trace.total < SSD1681_TRACE_DEPTH) ? g_trace.total : SSD1681_TRACE_DEPTH;
+#else
+    return 0;
+#endif
+}
+
+/**
+ * @brief Read a captured event, index 0 is the oldest
+ */
+int ssd1681_trace_get(uint32_t index, ssd1681_trace_event_t *event)
+{
+#ifdef SSD1681_TRACE
+    uint32_t count = ssd1681_trace_count();
+    if (!event) return -2;
+    if (index >= count) return -3;
+
+    uint32_t first = (g_trace.head + SSD1681_TRACE_DEPTH - count) % SSD1681_TRACE_DEPTH;
+    *event = g_trace.events[(first + index) % SSD1681_TRACE_DEPTH];
+    return 0;
+#else
+    (void)index;
+    (void)event;
+    return -1;
+#endif
+}
+
+/**
+ * @brief Print the captured trace in the text export format
+ */
+void ssd1681_trace_print(void)
+{
+#ifdef SSD1681_TRACE
+    uint32_t count = ssd1681_trace_count();
+
+    printf("# ssd1681-trace v1 events=%u dropped=%u\n",
+           (unsigned)count, (unsigned)(g_trace.total - count));
+
+    for (uint32_t i = 0; i < count; i++) {
+        ssd1681_trace_event_t ev;
+        if (ssd1681_trace_get(i, &ev) != 0) break;
+
+        if (ev.kind == SSD1681_TRACE_CMD) {
+            printf("%llu C %02x\n", (unsigned long long)ev.time_us, (unsigned)ev.value);
+        } else if (ev.kind == SSD1681_TRACE_BUSY) {
+            printf("%llu B %u\n", (unsigned long long)ev.time_us, (unsigned)ev.value);
+        } else {
+            printf("%llu D %u %08x", (unsigned long long)ev.time_us, (unsigned)ev.len, (unsigned)ev.value);
+            for (uint32_t b = 0; b < ev.len && b < sizeof(ev.head); b++) {
+                printf(" %02x", ev.head[b]);
+            }
+            printf("\n");
+        }
+    }
+#endif
+}
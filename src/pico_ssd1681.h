@@ -16,6 +16,27 @@
 extern "C" {
 #endif
 
+/**
+ * @brief Panel geometry, fixed at compile time
+ * @note Override with -DSSD1681_PANEL_WIDTH=... -DSSD1681_PANEL_HEIGHT=... (see CMakeLists.txt).
+ *       Width must be a multiple of 8. Defaults match the 200x200 SSD1681 glass.
+ */
+#ifndef SSD1681_PANEL_WIDTH
+#define SSD1681_PANEL_WIDTH  200
+#endif
+
+#ifndef SSD1681_PANEL_HEIGHT
+#define SSD1681_PANEL_HEIGHT 200
+#endif
+
+/**
+ * @brief Controller-native plane layout
+ * @note One bit per pixel, MSB is the leftmost pixel, 1=white/0=inked.
+ *       Rows are SSD1681_PLANE_STRIDE bytes and stored bottom-up: row 0 holds y = SSD1681_PANEL_HEIGHT - 1.
+ */
+#define SSD1681_PLANE_STRIDE (SSD1681_PANEL_WIDTH / 8)
+#define SSD1681_PLANE_SIZE   (SSD1681_PLANE_STRIDE * SSD1681_PANEL_HEIGHT)
+
 /**
  * @brief SPI mode configuration
  */
@@ -79,12 +100,69 @@ typedef struct {
 
 /**
  * @brief Color selection
+ * @note With SSD1681_MONOCHROME (black/white glass) there is no red plane: drawing in
+ *       SSD1681_COLOR_RED returns an error and RGB dithering folds red into the black plane.
  */
 typedef enum {
     SSD1681_COLOR_BLACK = 0,
     SSD1681_COLOR_RED = 1,
 } ssd1681_color_t;
 
+/**
+ * @brief Pixel color across both planes, for the tri-color primitives
+ * @note RED leaves the black plane white. With SSD1681_MONOCHROME, RED is rejected.
+ */
+typedef enum {
+    SSD1681_TRI_WHITE = 0,
+    SSD1681_TRI_BLACK = 1,
+    SSD1681_TRI_RED = 2,
+} ssd1681_tricolor_t;
+
+/**
+ * @brief How source ink (a layer or a pattern) is combined with the plane, inside its mask or region
+ */
+typedef enum {
+    SSD1681_ROP_COPY = 0,  /**< Source pixels replace what is below */
+    SSD1681_ROP_OR = 1,    /**< Ink is added */
+    SSD1681_ROP_AND = 2,   /**< Only ink present in both survives */
+    SSD1681_ROP_XOR = 3,   /**< Source ink inverts what is below */
+} ssd1681_rop_t;
+
+/**
+ * @brief Inclusive pixel rectangle
+ */
+typedef struct {
+    uint16_t left;
+    uint16_t top;
+    uint16_t right;
+    uint16_t bottom;
+} ssd1681_rect_t;
+
+/**
+ * @brief Asset encodings
+ * @note Run-length tokens, shared by assets, the page cache and the remote protocol: a control
+ *       byte c covers (c & 0x7F) + 1 bytes. With bit 7 clear, that many literal bytes follow;
+ *       with bit 7 set, one byte follows and is repeated. Runs shorter than 3 bytes are kept in
+ *       literals. Host side encoder: tools/ssd1681_codec.py.
+ */
+typedef enum {
+    SSD1681_ASSET_RAW = 0,  /**< Plain rows */
+    SSD1681_ASSET_RLE = 1,  /**< Run-length tokens of the rows */
+} ssd1681_asset_encoding_t;
+
+/**
+ * @brief Bitmap in controller-native layout, generated at build time by tools/ssd1681_asset.py
+ * @note 1=white, MSB leftmost, rows of stride bytes stored bottom-up, like a plane.
+ */
+typedef struct {
+    uint16_t width;       /**< Pixels */
+    uint16_t height;      /**< Rows */
+    uint16_t stride;      /**< Bytes per row, (width + 7) / 8 */
+    uint8_t encoding;     /**< ssd1681_asset_encoding_t */
+    uint32_t size;        /**< Bytes in data */
+    const uint8_t *data;
+} ssd1681_asset_t;
+
 /**
  * @brief Display update type
  * @note UPDATE_FAST_PARTIAL: only draws new pixels (immidiate, ghosting likely)
@@ -116,6 +194,62 @@ enum ssd1681_font_size_t{
     SSD1681_FONT_48 = 48,
 };
 
+/**
+ * @brief Dither algorithm used when converting 8-bit images to 1bpp planes
+ * @note DITHER_NONE: plain threshold at mid-gray
+ * @note DITHER_ORDERED: 4x4 Bayer matrix, no state carried between pixels
+ * @note DITHER_FLOYD_STEINBERG: serpentine error diffusion (7/16, 3/16, 5/16, 1/16)
+ */
+typedef enum {
+    SSD1681_DITHER_NONE = 0,
+    SSD1681_DITHER_ORDERED = 1,
+    SSD1681_DITHER_FLOYD_STEINBERG = 2,
+} ssd1681_dither_mode_t;
+
+/**
+ * @brief Source pixel format accepted by the dither stage
+ */
+typedef enum {
+    SSD1681_PIXEL_GRAY8 = 0,   /**< 1 byte per pixel, 0=black, 255=white. Only the black plane is written */
+    SSD1681_PIXEL_RGB888 = 1,  /**< 3 bytes per pixel (R, G, B). Red pixels are extracted to the red plane */
+} ssd1681_pixel_format_t;
+
+/**
+ * @brief Horizontal text alignment inside a box
+ */
+typedef enum {
+    SSD1681_ALIGN_LEFT = 0,
+    SSD1681_ALIGN_CENTER = 1,
+    SSD1681_ALIGN_RIGHT = 2,
+} ssd1681_align_t;
+
+/**
+ * @brief Bus trace ring buffer depth (events), used when built with SSD1681_TRACE
+ */
+#ifndef SSD1681_TRACE_DEPTH
+#define SSD1681_TRACE_DEPTH 256
+#endif
+
+/**
+ * @brief Kind of a traced bus event
+ */
+typedef enum {
+    SSD1681_TRACE_CMD = 0,   /**< Command byte */
+    SSD1681_TRACE_DATA = 1,  /**< Data bytes following a command (consecutive writes folded together) */
+    SSD1681_TRACE_BUSY = 2,  /**< Wait for BUSY to drop */
+} ssd1681_trace_kind_t;
+
+/**
+ * @brief One traced bus event
+ */
+typedef struct {
+    uint64_t time_us;  /**< time_us_64() at the start of the event */
+    uint32_t value;    /**< CMD: opcode, DATA: FNV-1a hash of the payload, BUSY: wait time in us */
+    uint32_t len;      /**< DATA: payload length in bytes */
+    uint8_t head[4];   /**< DATA: first payload bytes */
+    uint8_t kind;      /**< ssd1681_trace_kind_t */
+} ssd1681_trace_event_t;
+
 /**
  * @brief Initialize the display
  * @param config Pin configuration
@@ -123,6 +257,57 @@ enum ssd1681_font_size_t{
  */
 int ssd1681_init(const ssd1681_config_t *config);
 
+/**
+ * @brief Init table pseudo-opcodes (no SSD1681 command uses 0xFD-0xFF)
+ *
+ * An init table is a byte stream of entries:
+ *   cmd, len, data[len]           command and its payload
+ *   SSD1681_INIT_DELAY_MS, ms     fixed delay
+ *   SSD1681_INIT_WAIT_BUSY        wait for BUSY to drop
+ *   SSD1681_INIT_END              end of table
+ * Consecutive commands are sent in one CS transaction.
+ */
+#define SSD1681_INIT_DELAY_MS  0xFD
+#define SSD1681_INIT_WAIT_BUSY 0xFE
+#define SSD1681_INIT_END       0xFF
+
+/**
+ * @brief Init table used by ssd1681_init(), for this build's panel geometry
+ */
+extern const uint8_t ssd1681_default_init_table[];
+
+/**
+ * @brief Initialize the display with a custom init table (other glass variants)
+ * @param config Pin configuration
+ * @param table Init table run after the hardware reset, NULL for ssd1681_default_init_table
+ * @return 0 on success, -4 if the table is malformed, other errors as ssd1681_init()
+ * @note The table must leave the controller in data entry mode 0x01 (Y decrement, X increment)
+ *       with a full-panel RAM window, which the drawing and upload paths assume.
+ */
+int ssd1681_init_with_table(const ssd1681_config_t *config, const uint8_t *table);
+
+/**
+ * @brief Time the last init took, from hardware reset to the end of the init table
+ * @return Microseconds
+ */
+uint32_t ssd1681_get_init_time_us(void);
+
+/**
+ * @brief Set up and initialize another panel driven by this driver (multi-panel signs)
+ * @param config Pins of the extra panel; may share the SPI port (own CS/BUSY) or use the other one
+ * @return 0 on success, -1 if ssd1681_init() has not been called
+ * @note Runs the same init table as ssd1681_init(). The new panel is left bound.
+ */
+int ssd1681_attach_panel(const ssd1681_config_t *config);
+
+/**
+ * @brief Route all following bus traffic (uploads, refreshes, BUSY waits) to another panel
+ * @param config Pins of a panel set up by ssd1681_init() or ssd1681_attach_panel()
+ * @return 0 on success
+ * @note The planes are not switched, pair this with ssd1681_set_framebuffers().
+ */
+int ssd1681_bind_panel(const ssd1681_config_t *config);
+
 /**
  * @brief Deinitialize the display
  */
@@ -133,6 +318,8 @@ void ssd1681_deinit(void);
  * @brief Clear the display
  * @param color Color plane to clear
  * @return 0 on success
+ * @note Clears both the host buffer and the controller RAM (on-chip auto fill, no plane upload).
+ *       The panel itself changes on the next ssd1681_update().
  */
 int ssd1681_clear(ssd1681_color_t color);
 
@@ -146,12 +333,12 @@ int ssd1681_write_buffer(ssd1681_color_t color);
 /**
  * @brief Write a single point
  * @param color Color plane
- * @param x X coordinate (0-199)
- * @param y Y coordinate (0-199)
+ * @param x X coordinate (0 to SSD1681_PANEL_WIDTH - 1)
+ * @param y Y coordinate (0 to SSD1681_PANEL_HEIGHT - 1)
  * @param data 1=on, 0=off
  * @return 0 on success
  */
-int ssd1681_write_point(ssd1681_color_t color, uint8_t x, uint8_t y, uint8_t data);
+int ssd1681_write_point(ssd1681_color_t color, uint16_t x, uint16_t y, uint8_t data);
 
 /**
  * @brief Read a single point
@@ -161,7 +348,7 @@ int ssd1681_write_point(ssd1681_color_t color, uint8_t x, uint8_t y, uint8_t dat
  * @param data Output: pixel value
  * @return 0 on success
  */
-int ssd1681_read_point(ssd1681_color_t color, uint8_t x, uint8_t y, uint8_t *data);
+int ssd1681_read_point(ssd1681_color_t color, uint16_t x, uint16_t y, uint8_t *data);
 
 /**
  * @brief Draw a string
@@ -174,10 +361,54 @@ int ssd1681_read_point(ssd1681_color_t color, uint8_t x, uint8_t y, uint8_t *dat
  * @param font Font size
  * @return 0 on success
  */
-int ssd1681_draw_string(ssd1681_color_t color, uint8_t x, uint8_t y, 
+int ssd1681_draw_string(ssd1681_color_t color, uint16_t x, uint16_t y, 
                         const char *str, uint16_t len, uint8_t data, 
                         uint8_t font);
 
+/**
+ * @brief Measure text extents
+ * @param str String to measure
+ * @param len String length
+ * @param font Font size
+ * @param max_width Wrap width in pixels as used by ssd1681_draw_text(), 0 for no wrapping
+ * @param width Output: widest line in pixels (may be NULL)
+ * @param height Output: total height of all lines in pixels (may be NULL)
+ * @return 0 on success
+ * @note '\n' always starts a new line
+ */
+int ssd1681_measure_text(const char *str, uint16_t len, uint8_t font,
+                         uint16_t max_width, uint16_t *width, uint16_t *height);
+
+/**
+ * @brief Draw text inside a box with alignment, word wrapping and clipping
+ * @param color Color plane
+ * @param box Bounding box, nothing is drawn outside it
+ * @param str String to draw
+ * @param len String length
+ * @param data 1=draw glyph pixels, 0=erase them (background is left untouched)
+ * @param font Font size
+ * @param align Horizontal alignment of each line
+ * @param wrap true to word-wrap at the box width, false to clip long lines
+ * @return 0 on success
+ */
+int ssd1681_draw_text(ssd1681_color_t color, const ssd1681_rect_t *box,
+                      const char *str, uint16_t len, uint8_t data,
+                      uint8_t font, ssd1681_align_t align, bool wrap);
+
+/**
+ * @brief Draw one line of text at an origin that may lie off the panel, clipped to the panel
+ * @param color Color
+ * @param x Left edge, may be negative (text scrolling in, text split across panels)
+ * @param y Top edge, may be negative
+ * @param str String to draw
+ * @param len String length
+ * @param data 1=draw glyph pixels, 0=erase them (background untouched)
+ * @param font Font size
+ * @return 0 on success
+ */
+int ssd1681_draw_text_at(ssd1681_color_t color, int16_t x, int16_t y,
+                         const char *str, uint16_t len, uint8_t data, uint8_t font);
+
 /**
  * @brief Fill a rectangle
  * @param color Color plane
@@ -188,8 +419,8 @@ int ssd1681_draw_string(ssd1681_color_t color, uint8_t x, uint8_t y,
  * @param data Fill value (1=filled, 0=empty)
  * @return 0 on success
  */
-int ssd1681_fill_rect(ssd1681_color_t color, uint8_t left, uint8_t top,
-                      uint8_t right, uint8_t bottom, uint8_t data);
+int ssd1681_fill_rect(ssd1681_color_t color, uint16_t left, uint16_t top,
+                      uint16_t right, uint16_t bottom, uint8_t data);
 
 /**
  * @brief Draw an image
@@ -201,8 +432,210 @@ int ssd1681_fill_rect(ssd1681_color_t color, uint8_t left, uint8_t top,
  * @param img Image buffer (1 bit per pixel, row-major)
  * @return 0 on success
  */
-int ssd1681_draw_picture(ssd1681_color_t color, uint8_t left, uint8_t top,
-                         uint8_t right, uint8_t bottom, const uint8_t *img);
+int ssd1681_draw_picture(ssd1681_color_t color, uint16_t left, uint16_t top,
+                         uint16_t right, uint16_t bottom, const uint8_t *img);
+
+/**
+ * @brief Write a single point on both planes
+ * @param x X coordinate
+ * @param y Y coordinate
+ * @param color White, black or red
+ * @return 0 on success
+ */
+int ssd1681_write_point_tri(uint16_t x, uint16_t y, ssd1681_tricolor_t color);
+
+/**
+ * @brief Read a single point from both planes
+ * @param x X coordinate
+ * @param y Y coordinate
+ * @param color Output: red if the red plane is inked, else black or white
+ * @return 0 on success
+ */
+int ssd1681_read_point_tri(uint16_t x, uint16_t y, ssd1681_tricolor_t *color);
+
+/**
+ * @brief Fill a rectangle on both planes in one pass, whole bytes at a time
+ * @param left Left coordinate
+ * @param top Top coordinate
+ * @param right Right coordinate
+ * @param bottom Bottom coordinate
+ * @param color White, black or red
+ * @return 0 on success
+ */
+int ssd1681_fill_rect_tri(uint16_t left, uint16_t top, uint16_t right, uint16_t bottom,
+                          ssd1681_tricolor_t color);
+
+/**
+ * @brief 8x8 brushes for ssd1681_fill_pattern(): one byte per row, 1=ink, MSB leftmost
+ */
+extern const uint8_t ssd1681_pattern_solid[8];
+extern const uint8_t ssd1681_pattern_checker[8];   /**< 50%, ink where x + y is even */
+extern const uint8_t ssd1681_pattern_gray25[8];
+extern const uint8_t ssd1681_pattern_gray75[8];
+extern const uint8_t ssd1681_pattern_diagonal[8];  /**< Hatching, lower left to upper right */
+extern const uint8_t ssd1681_pattern_hlines[8];
+extern const uint8_t ssd1681_pattern_vlines[8];
+
+/**
+ * @brief Combine an 8x8 pattern with a rectangle of a plane, whole bytes at a time
+ * @param color Color plane
+ * @param left Left coordinate
+ * @param top Top coordinate
+ * @param right Right coordinate
+ * @param bottom Bottom coordinate
+ * @param pattern 8 rows, 1=ink, MSB leftmost; anchored to the panel (row y uses pattern[y % 8])
+ *                so adjacent fills line up
+ * @param rop COPY paints the pattern, OR adds its ink, AND keeps existing ink only where the
+ *            pattern has ink (masking), XOR inverts where the pattern has ink
+ * @return 0 on success, -2/-3/-4 as ssd1681_fill_rect(), -5 for a NULL pattern or bad rop
+ */
+int ssd1681_fill_pattern(ssd1681_color_t color, uint16_t left, uint16_t top, uint16_t right, uint16_t bottom,
+                         const uint8_t pattern[8], ssd1681_rop_t rop);
+
+/**
+ * @brief Invert a rectangle of a plane in place (selection highlight), whole bytes at a time
+ * @return 0 on success, errors as ssd1681_fill_rect()
+ */
+int ssd1681_invert_rect(ssd1681_color_t color, uint16_t left, uint16_t top, uint16_t right, uint16_t bottom);
+
+/**
+ * @brief Draw a 1bpp image on both planes in one pass: set bits in color, clear bits white
+ * @param left Left coordinate
+ * @param top Top coordinate
+ * @param right Right coordinate
+ * @param bottom Bottom coordinate
+ * @param img Image data, same format as ssd1681_draw_picture()
+ * @param color Color of set bits
+ * @return 0 on success
+ */
+int ssd1681_draw_picture_tri(uint16_t left, uint16_t top, uint16_t right, uint16_t bottom,
+                             const uint8_t *img, ssd1681_tricolor_t color);
+
+/**
+ * @brief Copy a native-layout asset into a plane
+ * @param color Color plane
+ * @param left Left coordinate, a multiple of 8
+ * @param top Top coordinate
+ * @param asset Asset from ssd1681_add_assets()
+ * @return 0 on success, -3 if left is not byte aligned, -4 if the asset does not fit, -5 if corrupt
+ * @note Row copies (a single memcpy for full-width assets), no per-pixel work. Padding bits of the
+ *       last byte of each row are copied as white.
+ */
+int ssd1681_draw_asset(ssd1681_color_t color, uint16_t left, uint16_t top, const ssd1681_asset_t *asset);
+
+/**
+ * @brief Send a raw asset straight to the controller RAM window, bypassing the planes
+ * @return 0 on success, same errors as ssd1681_draw_asset(), -6 for RLE assets
+ */
+int ssd1681_write_asset(ssd1681_color_t color, uint16_t left, uint16_t top, const ssd1681_asset_t *asset);
+
+/**
+ * @brief Expand run-length tokens (see ssd1681_asset_encoding_t) into rows of a buffer
+ * @param dst First output row
+ * @param width Bytes per decoded row
+ * @param pitch Bytes from one output row to the next, width for a flat buffer
+ * @param total Bytes to decode, whole rows of width bytes
+ * @param src Tokens
+ * @param len Token bytes
+ * @return 0 on success, -2 for NULL buffers or a zero width, -5 if the tokens are truncated or
+ *         do not cover exactly total bytes
+ * @note Used by ssd1681_draw_asset() and the page cache. Every token is checked against len and
+ *       total before it is expanded; rows decoded before an error are left written.
+ */
+int ssd1681_rle_decode(uint8_t *dst, uint16_t width, uint16_t pitch, uint32_t total,
+                       const uint8_t *src, uint32_t len);
+
+/**
+ * @brief Attach application-owned planes in controller-native layout
+ * @param black Black plane (SSD1681_PLANE_SIZE bytes), NULL for the internal buffer
+ * @param red Red plane (SSD1681_PLANE_SIZE bytes), NULL for the internal buffer
+ * @return 0 on success
+ * @note All drawing and ssd1681_write_buffer() then operate on these buffers directly, without copying.
+ *       The buffers are not cleared. With SSD1681_EXTERNAL_FRAMEBUFFER the internal buffers are not
+ *       compiled in, NULL detaches the plane and drawing on it returns an error.
+ *       With SSD1681_MONOCHROME the red argument is ignored.
+ */
+int ssd1681_set_framebuffers(uint8_t *black, uint8_t *red);
+
+/**
+ * @brief Get the active plane
+ * @param color Color plane
+ * @return Plane in controller-native layout, NULL if not initialized or no plane is attached
+ */
+uint8_t *ssd1681_get_framebuffer(ssd1681_color_t color);
+
+/**
+ * @brief Write a region to display RAM straight from a caller buffer
+ * @param color Color plane
+ * @param left Left X coordinate
+ * @param top Top Y coordinate
+ * @param right Right X coordinate
+ * @param bottom Bottom Y coordinate
+ * @param src Native-polarity bytes of the top row, starting with the byte that holds pixel left
+ * @param stride Bytes from one row to the next one down, negative for bottom-up buffers
+ * @return 0 on success, -1 if not initialized, -2 for a NULL src, -3 if left/top is off the
+ *         panel, -4 if right/bottom is off the panel, -5 if left > right or top > bottom
+ * @note X is byte-granular: the bytes containing left and right are sent whole
+ */
+int ssd1681_write_region(ssd1681_color_t color, uint16_t left, uint16_t top,
+                         uint16_t right, uint16_t bottom, const uint8_t *src, int16_t stride);
+
+/**
+ * @brief Write a region of the active plane to display RAM
+ * @param color Color plane
+ * @param left Left X coordinate
+ * @param top Top Y coordinate
+ * @param right Right X coordinate
+ * @param bottom Bottom Y coordinate
+ * @return 0 on success, -1 if not initialized or no plane, else as ssd1681_write_region()
+ */
+int ssd1681_write_buffer_region(ssd1681_color_t color, uint16_t left, uint16_t top,
+                                uint16_t right, uint16_t bottom);
+
+/**
+ * @brief Start streaming an image through the dither stage
+ * @param mode Dither algorithm
+ * @param format Source pixel format
+ * @param left Left X coordinate of the destination area
+ * @param top Top Y coordinate of the destination area
+ * @param width Width of the destination area in pixels
+ * @param height Number of rows that will be passed to ssd1681_dither_row()
+ * @return 0 on success
+ * @note Rows are written straight into the framebuffer planes, no full-size intermediate buffer is needed
+ */
+int ssd1681_dither_begin(ssd1681_dither_mode_t mode, ssd1681_pixel_format_t format,
+                         uint16_t left, uint16_t top, uint16_t width, uint16_t height);
+
+/**
+ * @brief Dither one source row into the framebuffer
+ * @param row Source pixels for the next row (width pixels in the format given to ssd1681_dither_begin())
+ * @return 0 on success, -3 if no dither is in progress or all rows were already written
+ */
+int ssd1681_dither_row(const uint8_t *row);
+
+/**
+ * @brief Grayscale waveform size: 153 LUT bytes, then EOPT, VGH, VSH1, VSH2, VSL, VCOM
+ */
+#define SSD1681_GRAY_LUT_SIZE 159
+
+/**
+ * @brief Reference 4-level waveform, a starting point to tune for a given glass and temperature
+ */
+extern const uint8_t ssd1681_gray4_lut[SSD1681_GRAY_LUT_SIZE];
+
+/**
+ * @brief Show a 4-level grayscale image in a single refresh (black/white glass)
+ * @param img 2bpp image, 4 pixels per byte MSB first, rows top-down, SSD1681_PANEL_WIDTH / 4 bytes
+ *            per row; 0=black, 1=dark gray, 2=light gray, 3=white
+ * @param lut Waveform (SSD1681_GRAY_LUT_SIZE bytes), NULL for ssd1681_gray4_lut
+ * @return 0 on success
+ * @note The image is streamed straight to controller RAM, one level bit per RAM (BW 0x24 and
+ *       RED/old 0x26), so no framebuffer is used and the planes are left untouched. The LUT
+ *       stays loaded only for this refresh: the normal update modes reload the OTP waveform,
+ *       and the next ssd1681_update() first puts RED RAM back in step with the red plane.
+ *       Follow with a clean full update when going back to 1bpp content.
+ */
+int ssd1681_show_gray(const uint8_t *img, const uint8_t *lut);
 
 /**
  * @brief Set soft start parameters
@@ -224,6 +657,75 @@ int ssd1681_update(uint8_t update_type);
  */
 int ssd1681_write_buffer_and_update_if_ready(uint8_t update_type);
 
+/**
+ * @brief Submit the current framebuffer contents for display
+ * @param update_type Update type (see ssd1681_update_type_t)
+ * @return 0 on success
+ * @note Never blocks. If a frame is already pending it is replaced (newest wins); the pending
+ *       update type is kept if it is more thorough than the new one. The frame is sent by
+ *       ssd1681_service_frames(), so drawing after submitting simply updates the pending frame.
+ *       ssd1681_service_frames() itself blocks for FAST_FULL and CLEAN_FULL_AGGRESSIVE.
+ */
+int ssd1681_submit_frame(uint8_t update_type);
+
+/**
+ * @brief Push the pending frame to the panel when it is free, call this regularly (e.g. main loop)
+ * @return 1 if a refresh was started, 0 if nothing is pending, 2 if waiting (panel busy or
+ *         minimum interval not elapsed), negative on error
+ * @note Returns at once for FAST_PARTIAL and CLEAN_FULL. A pending FAST_FULL or
+ *       CLEAN_FULL_AGGRESSIVE frame blocks until its refresh completes, as these run several
+ *       refresh passes through ssd1681_write_buffer_and_update_if_ready().
+ */
+int ssd1681_service_frames(void);
+
+/**
+ * @brief Set the minimum time between two refreshes started by the frame queue
+ * @param interval_ms Minimum interval in milliseconds, 0 to refresh as soon as the panel is free
+ */
+void ssd1681_set_min_refresh_interval(uint32_t interval_ms);
+
+/**
+ * @brief Check for a frame waiting for the panel
+ * @return true if a submitted frame has not been sent yet
+ */
+bool ssd1681_frame_pending(void);
+
+/**
+ * @brief Number of frames replaced by newer ones before reaching the panel
+ */
+uint32_t ssd1681_frames_coalesced(void);
+
+/**
+ * @brief Start recording commands, data and BUSY waits into the trace ring buffer
+ * @return 0 on success, -1 if the library was built without SSD1681_TRACE
+ */
+int ssd1681_trace_start(void);
+
+/**
+ * @brief Stop recording, captured events are kept
+ */
+void ssd1681_trace_stop(void);
+
+/**
+ * @brief Number of events held in the ring buffer
+ */
+uint32_t ssd1681_trace_count(void);
+
+/**
+ * @brief Read a captured event
+ * @param index Event index, 0 is the oldest
+ * @param event Output event
+ * @return 0 on success
+ */
+int ssd1681_trace_get(uint32_t index, ssd1681_trace_event_t *event);
+
+/**
+ * @brief Print the trace with printf in the text export format
+ * @note One event per line: "<time_us> C <opcode>", "<time_us> D <len> <hash> <first bytes>",
+ *       "<time_us> B <wait_us>". Compare against a golden capture with tools/ssd1681_trace_diff.py.
+ */
+void ssd1681_trace_print(void);
+
 /**
  * @brief Get default configuration for 4-wire SPI
  * @param config Output configuration
@@ -0,0 +1,305 @@
+/**
+ * SSD1681 C++ Front-End
+ * Panel type templated on SPI mode, port and pins; bus writes compile to straight-line register access
+ *
+ * Copyright (c) 2026 OpenCode
+ * SPDX-License-Identifier: MIT
+ */
+
+#ifndef PICO_SSD1681_HPP
+#define PICO_SSD1681_HPP
+
+#include "pico_ssd1681.h"
+#include "pico/stdlib.h"
+#include "hardware/spi.h"
+#include "hardware/gpio.h"
+
+#include <cstddef>
+#include <cstdint>
+
+namespace ssd1681 {
+
+/*
+ * The C driver keeps the panel configuration at run time, so every byte goes through
+ * spi_mode checks and a baud rate query. Panel<> fixes the configuration at compile time:
+ * the bus format is set once (init()/bind()), the mode branches are resolved with
+ * if constexpr, and the pins and SPI block are constants, so commands and RAM uploads
+ * cost only the bus time. 3-wire frames are streamed through the FIFO instead of
+ * waiting for each one.
+ *
+ * Planes, drawing and refresh stay in the C driver: Panel<> calls the C API for
+ * everything that is not bus traffic, and uses the planes it owns. Traffic sent through
+ * Panel<> is not recorded by the bus trace (SSD1681_TRACE).
+ */
+template <ssd1681_spi_mode_t Mode, uint8_t Port, uint8_t PinMosi, uint8_t PinSck, uint8_t PinCs,
+          uint8_t PinDc, uint8_t PinRst, uint8_t PinBusy, uint32_t Baudrate = 4000000>
+class Panel {
+    static_assert(Mode == SSD1681_SPI_4WIRE || Mode == SSD1681_SPI_3WIRE, "unknown SPI mode");
+    static_assert(Port <= 1, "SPI port must be 0 or 1");
+
+public:
+    /** @brief Same settings as a C ssd1681_config_t, for the C API */
+    static constexpr ssd1681_config_t config = {
+        Mode, Port, PinMosi, PinSck, PinCs, PinDc, PinRst, PinBusy, Baudrate,
+    };
+
+    /**
+     * @brief Initialize the driver on this panel (ssd1681_init_with_table())
+     * @param table Init table, nullptr for ssd1681_default_init_table
+     * @return 0 on success, C driver error otherwise
+     */
+    static int init(const uint8_t *table = nullptr)
+    {
+        int ret = ssd1681_init_with_table(&config, table);
+        if (ret == 0) configure_bus();
+        return ret;
+    }
+
+    /**
+     * @brief Bring up this panel as an additional panel (ssd1681_attach_panel())
+     */
+    static int attach()
+    {
+        int ret = ssd1681_attach_panel(&config);
+        if (ret == 0) configure_bus();
+        return ret;
+    }
+
+    /**
+     * @brief Route C API traffic to this panel and set the bus format for it
+     * @note Needed when panels with different modes or clocks share an SPI port.
+     */
+    static int bind()
+    {
+        int ret = ssd1681_bind_panel(&config);
+        if (ret == 0) configure_bus();
+        return ret;
+    }
+
+    /**
+     * @brief Check the BUSY pin
+     */
+    static bool busy()
+    {
+        return gpio_get(PinBusy);
+    }
+
+    /**
+     * @brief Wait for BUSY to drop, with the same settle time as the C driver
+     */
+    static void wait_busy()
+    {
+        for (int32_t timeout = 1000000; busy() && timeout > 0; timeout--) {
+            sleep_us(10);
+        }
+        sleep_us(100);
+    }
+
+    /**
+     * @brief Send a command and its parameters in one CS transaction
+     */
+    static void command(uint8_t cmd, const uint8_t *data = nullptr, size_t len = 0)
+    {
+        select();
+        send<false>(&cmd, 1);
+        if (len) send<true>(data, len);
+        deselect();
+    }
+
+    /**
+     * @brief Set the RAM window and cursor, all four commands in one CS transaction
+     * @note Coordinates in RAM units as the C driver sends them: x in pixels (sent / 8), y as-is.
+     */
+    static void set_window(uint16_t x_start, uint16_t y_start, uint16_t x_end, uint16_t y_end,
+                           uint16_t x_cursor, uint16_t y_cursor)
+    {
+        const uint8_t x_range[] = {uint8_t(x_start / 8), uint8_t(x_end / 8)};
+        const uint8_t y_range[] = {uint8_t(y_start), uint8_t(y_start >> 8), uint8_t(y_end), uint8_t(y_end >> 8)};
+        const uint8_t x_counter = uint8_t(x_cursor / 8);
+        const uint8_t y_counter[] = {uint8_t(y_cursor), uint8_t(y_cursor >> 8)};
+
+        select();
+        send_command(0x44, x_range, sizeof(x_range));
+        send_command(0x45, y_range, sizeof(y_range));
+        send_command(0x4E, &x_counter, 1);
+        send_command(0x4F, y_counter, sizeof(y_counter));
+        deselect();
+    }
+
+    /**
+     * @brief Stream bytes into the BW or RED RAM at the current cursor
+     */
+    static void write_ram(ssd1681_color_t color, const uint8_t *data, size_t len)
+    {
+        command(color == SSD1681_COLOR_BLACK ? 0x24 : 0x26, data, len);
+    }
+
+    /**
+     * @brief Upload a whole plane (ssd1681_write_buffer())
+     * @return 0 on success, -1 if the driver is not initialized or has no such plane
+     */
+    static int write_buffer(ssd1681_color_t color)
+    {
+        const uint8_t *plane = ssd1681_get_framebuffer(color);
+        if (!plane) return -1;
+
+        wait_busy();
+        set_window(0, 0, SSD1681_PANEL_WIDTH - 1, SSD1681_PANEL_HEIGHT - 1, 0, 0);
+        write_ram(color, plane, SSD1681_PLANE_SIZE);
+        return 0;
+    }
+
+    /**
+     * @brief Upload a region from any pointer and stride (ssd1681_write_region())
+     * @return 0 on success, same errors as ssd1681_write_region()
+     */
+    static int write_region(ssd1681_color_t color, uint16_t left, uint16_t top, uint16_t right, uint16_t bottom,
+                            const uint8_t *src, int16_t stride)
+    {
+        if (!src) return -2;
+        if (left >= SSD1681_PANEL_WIDTH || top >= SSD1681_PANEL_HEIGHT) return -3;
+        if (right >= SSD1681_PANEL_WIDTH || bottom >= SSD1681_PANEL_HEIGHT) return -4;
+        if (left > right || top > bottom) return -5;
+
+        const uint16_t row_bytes = right / 8 - left / 8 + 1;
+
+        /* Full-height Y window and cursor as in the C driver, rows go bottom-up */
+        wait_busy();
+        set_window(left, 0, right, SSD1681_PANEL_HEIGHT - 1,
+                   left, (bottom == SSD1681_PANEL_HEIGHT - 1) ? 0 : bottom + 1);
+
+        select();
+        const uint8_t cmd = (color == SSD1681_COLOR_BLACK) ? 0x24 : 0x26;
+        send<false>(&cmd, 1);
+        dc<true>();
+        for (int32_t y = bottom; y >= top; y--) {
+            queue<true>(src + (int32_t)(y - top) * stride, row_bytes);
+        }
+        deselect();
+        return 0;
+    }
+
+    /**
+     * @brief Upload a region of the active plane (ssd1681_write_buffer_region())
+     */
+    static int write_buffer_region(ssd1681_color_t color, uint16_t left, uint16_t top, uint16_t right, uint16_t bottom)
+    {
+        const uint8_t *plane = ssd1681_get_framebuffer(color);
+        if (!plane) return -1;
+        if (left >= SSD1681_PANEL_WIDTH || top >= SSD1681_PANEL_HEIGHT) return -3;
+        if (right >= SSD1681_PANEL_WIDTH || bottom >= SSD1681_PANEL_HEIGHT) return -4;
+        if (left > right || top > bottom) return -5;
+
+        const uint32_t offset = (uint32_t)(SSD1681_PANEL_HEIGHT - 1 - top) * SSD1681_PLANE_STRIDE + left / 8;
+        return write_region(color, left, top, right, bottom, plane + offset, -SSD1681_PLANE_STRIDE);
+    }
+
+    /**
+     * @brief Upload both planes and start a refresh
+     * @param update_type Update type passed to ssd1681_update()
+     * @return 0 on success, negative on error
+     * @note The refresh runs on after return, like ssd1681_update(). Bind this panel first
+     *       if the C driver is bound to another one.
+     */
+    static int flush(uint8_t update_type)
+    {
+        int ret = write_buffer(SSD1681_COLOR_BLACK);
+        if (ret != 0) return ret;
+        if (ssd1681_get_framebuffer(SSD1681_COLOR_RED)) {
+            write_buffer(SSD1681_COLOR_RED);
+        }
+        return ssd1681_update(update_type);
+    }
+
+private:
+    static spi_inst_t *spi()
+    {
+        return (Port == 0) ? spi0 : spi1;
+    }
+
+    /** @brief Baud rate and frame format, once per bind instead of per byte */
+    static void configure_bus()
+    {
+        if (spi_get_baudrate(spi()) != Baudrate) {
+            spi_set_baudrate(spi(), Baudrate);
+        }
+
+        if constexpr (Mode == SSD1681_SPI_3WIRE) {
+            /* 9-bit frames, the D/C bit goes first */
+            spi_hw_t *hw = spi_get_hw(spi());
+            hw_clear_bits(&hw->cr1, SPI_SSPCR1_SSE_BITS);
+            hw->cr0 = (8 << SPI_SSPCR0_DSS_LSB) | (0 << SPI_SSPCR0_FRF_LSB) |
+                      (0 << SPI_SSPCR0_SPO_LSB) | (0 << SPI_SSPCR0_SPH_LSB);
+            hw_set_bits(&hw->cr1, SPI_SSPCR1_SSE_BITS);
+        } else {
+            spi_set_format(spi(), 8, SPI_CPOL_0, SPI_CPHA_0, SPI_MSB_FIRST);
+        }
+    }
+
+    static void select()
+    {
+        gpio_put(PinCs, 0);
+    }
+
+    /** @brief Let the last frame leave the shifter, discard RX and release CS */
+    static void deselect()
+    {
+        wait_idle();
+        gpio_put(PinCs, 1);
+    }
+
+    static void wait_idle()
+    {
+        spi_hw_t *hw = spi_get_hw(spi());
+        while (spi_is_busy(spi())) tight_loop_contents();
+        while (spi_is_readable(spi())) (void)hw->dr;
+        hw->icr = SPI_SSPICR_RORIC_BITS;
+    }
+
+    /** @brief Switch between command and data; 4-wire drains first, D/C is sampled with each byte */
+    template <bool Data>
+    static void dc()
+    {
+        if constexpr (Mode == SSD1681_SPI_4WIRE) {
+            wait_idle();
+            gpio_put(PinDc, Data);
+        }
+    }
+
+    /** @brief Queue bytes in the FIFO as command (Data false) or data frames */
+    template <bool Data>
+    static void queue(const uint8_t *p, size_t n)
+    {
+        spi_hw_t *hw = spi_get_hw(spi());
+
+        /* 3-wire: D/C travels in bit 8 of each frame */
+        constexpr uint32_t frame_dc = (Mode == SSD1681_SPI_3WIRE && Data) ? 0x100 : 0;
+        for (size_t i = 0; i < n; i++) {
+            while (!spi_is_writable(spi())) tight_loop_contents();
+            hw->dr = frame_dc | p[i];
+        }
+    }
+
+    template <bool Data>
+    static void send(const uint8_t *p, size_t n)
+    {
+        dc<Data>();
+        queue<Data>(p, n);
+    }
+
+    static void send_command(uint8_t cmd, const uint8_t *data, size_t len)
+    {
+        send<false>(&cmd, 1);
+        send<true>(data, len);
+    }
+};
+
+/** @brief Pins of ssd1681_get_default_config_4wire() */
+using DefaultPanel4Wire = Panel<SSD1681_SPI_4WIRE, 0, 19, 18, 17, 20, 21, 22>;
+
+/** @brief Pins of ssd1681_get_default_config_3wire() */
+using DefaultPanel3Wire = Panel<SSD1681_SPI_3WIRE, 0, 19, 18, 17, 0, 21, 22>;
+
+}  // namespace ssd1681
+
+#endif /* pico_ssd1681.hpp */
@@ -0,0 +1,278 @@
+/**
+ * SSD1681 Tiled Canvas
+ * One drawing surface spanning several panels, refreshed in parallel
+ *
+ * Copyright (c) 2026 OpenCode
+ * SPDX-License-Identifier: MIT
+ */
+
+#include "pico_ssd1681_canvas.h"
+#include "hardware/gpio.h"
+#include "pico/stdlib.h"
+
+#include <string.h>
+
+typedef struct {
+    ssd1681_canvas_tile_t tile;
+    bool dirty;  /* Planes changed since the last flush */
+} ssd1681_canvas_slot_t;
+
+static struct {
+    ssd1681_canvas_slot_t slots[SSD1681_CANVAS_MAX_TILES];
+    uint8_t count;
+    uint16_t width;
+    uint16_t height;
+} g_canvas = {0};
+
+/* Clipped rectangle in tile coordinates */
+typedef struct {
+    uint16_t left;
+    uint16_t top;
+    uint16_t right;
+    uint16_t bottom;
+} canvas_clip_t;
+
+static bool canvas_clip(const ssd1681_canvas_tile_t *t, uint16_t left, uint16_t top,
+                        uint16_t right, uint16_t bottom, canvas_clip_t *out)
+{
+    uint32_t l = (left > t->x) ? left : t->x;
+    uint32_t tp = (top > t->y) ? top : t->y;
+    uint32_t r = (uint32_t)t->x + SSD1681_PANEL_WIDTH - 1;
+    uint32_t b = (uint32_t)t->y + SSD1681_PANEL_HEIGHT - 1;
+    if (right < r) r = right;
+    if (bottom < b) b = bottom;
+    if (l > r || tp > b) return false;
+
+    out->left = l - t->x;
+    out->top = tp - t->y;
+    out->right = r - t->x;
+    out->bottom = b - t->y;
+    return true;
+}
+
+/* Point drawing at the tile's planes; false if the tile has no plane for this color */
+static bool canvas_select(ssd1681_canvas_slot_t *s, ssd1681_color_t color)
+{
+    const ssd1681_canvas_tile_t *t = &s->tile;
+    if (!((color == SSD1681_COLOR_BLACK) ? t->black : t->red)) return false;
+
+    ssd1681_set_framebuffers(t->black, t->red);
+    s->dirty = true;
+    return true;
+}
+
+/**
+ * @brief Initialize all panels of a canvas
+ */
+int ssd1681_canvas_init(const ssd1681_canvas_tile_t *tiles, uint8_t count)
+{
+    if (!tiles) return -2;
+    if (count == 0 || count > SSD1681_CANVAS_MAX_TILES) return -3;
+    for (uint8_t i = 0; i < count; i++) {
+        if (!tiles[i].black) return -2;
+    }
+
+    int ret = ssd1681_init(&tiles[0].config);
+    if (ret != 0) return ret;
+    for (uint8_t i = 1; i < count; i++) {
+        ret = ssd1681_attach_panel(&tiles[i].config);
+        if (ret != 0) return ret;
+    }
+
+    memset(&g_canvas, 0, sizeof(g_canvas));
+    g_canvas.count = count;
+    for (uint8_t i = 0; i < count; i++) {
+        ssd1681_canvas_slot_t *s = &g_canvas.slots[i];
+        s->tile = tiles[i];
+        s->dirty = true;
+
+        memset(s->tile.black, 0xFF, SSD1681_PLANE_SIZE);
+        if (s->tile.red) memset(s->tile.red, 0xFF, SSD1681_PLANE_SIZE);
+
+        if (s->tile.x + SSD1681_PANEL_WIDTH > g_canvas.width) g_canvas.width = s->tile.x + SSD1681_PANEL_WIDTH;
+        if (s->tile.y + SSD1681_PANEL_HEIGHT > g_canvas.height) g_canvas.height = s->tile.y + SSD1681_PANEL_HEIGHT;
+    }
+
+    return 0;
+}
+
+/**
+ * @brief Canvas size
+ */
+void ssd1681_canvas_get_size(uint16_t *width, uint16_t *height)
+{
+    if (width) *width = g_canvas.width;
+    if (height) *height = g_canvas.height;
+}
+
+/**
+ * @brief Clear a color on all tiles
+ */
+int ssd1681_canvas_clear(ssd1681_color_t color)
+{
+    if (g_canvas.count == 0) return -1;
+
+    for (uint8_t i = 0; i < g_canvas.count; i++) {
+        ssd1681_canvas_slot_t *s = &g_canvas.slots[i];
+        uint8_t *plane = (color == SSD1681_COLOR_BLACK) ? s->tile.black : s->tile.red;
+        if (!plane) continue;
+
+        memset(plane, 0xFF, SSD1681_PLANE_SIZE);
+        s->dirty = true;
+    }
+    return 0;
+}
+
+/**
+ * @brief Draw a pixel in canvas coordinates
+ */
+int ssd1681_canvas_write_point(ssd1681_color_t color, uint16_t x, uint16_t y, uint8_t data)
+{
+    if (g_canvas.count == 0) return -1;
+
+    for (uint8_t i = 0; i < g_canvas.count; i++) {
+        ssd1681_canvas_slot_t *s = &g_canvas.slots[i];
+        canvas_clip_t c;
+        if (!canvas_clip(&s->tile, x, y, x, y, &c)) continue;
+        if (!canvas_select(s, color)) return -1;
+
+        return ssd1681_write_point(color, c.left, c.top, data);
+    }
+    return -2;
+}
+
+/**
+ * @brief Fill a rectangle in canvas coordinates
+ */
+int ssd1681_canvas_fill_rect(ssd1681_color_t color, uint16_t left, uint16_t top,
+                             uint16_t right, uint16_t bottom, uint8_t data)
+{
+    if (g_canvas.count == 0) return -1;
+    if (left > right || top > bottom) return -4;
+
+    for (uint8_t i = 0; i < g_canvas.count; i++) {
+        ssd1681_canvas_slot_t *s = &g_canvas.slots[i];
+        canvas_clip_t c;
+        if (!canvas_clip(&s->tile, left, top, right, bottom, &c)) continue;
+        if (!canvas_select(s, color)) continue;
+
+        ssd1681_fill_rect(color, c.left, c.top, c.right, c.bottom, data);
+    }
+    return 0;
+}
+
+/**
+ * @brief Draw an image in canvas coordinates
+ */
+int ssd1681_canvas_draw_picture(ssd1681_color_t color, uint16_t left, uint16_t top,
+                                uint16_t right, uint16_t bottom, const uint8_t *img)
+{
+    if (g_canvas.count == 0) return -1;
+    if (!img) return -2;
+    if (left > right || top > bottom) return -5;
+
+    const uint16_t bytes_per_line = (right - left + 1 + 7) / 8;
+
+    for (uint8_t i = 0; i < g_canvas.count; i++) {
+        ssd1681_canvas_slot_t *s = &g_canvas.slots[i];
+        canvas_clip_t c;
+        if (!canvas_clip(&s->tile, left, top, right, bottom, &c)) continue;
+        if (!canvas_select(s, color)) continue;
+
+        /* Only the part of the image over this tile, sampled at its canvas position */
+        for (uint16_t y = c.top; y <= c.bottom; y++) {
+            const uint8_t *src = img + (uint32_t)(s->tile.y + y - top) * bytes_per_line;
+            for (uint16_t x = c.left; x <= c.right; x++) {
+                uint16_t ix = s->tile.x + x - left;
+                ssd1681_write_point(color, x, y, (src[ix / 8] >> (7 - ix % 8)) & 1);
+            }
+        }
+    }
+    return 0;
+}
+
+/**
+ * @brief Draw one line of text in canvas coordinates
+ */
+int ssd1681_canvas_draw_text(ssd1681_color_t color, uint16_t x, uint16_t y,
+                             const char *str, uint16_t len, uint8_t data, uint8_t font)
+{
+    if (g_canvas.count == 0) return -1;
+    if (!str) return -2;
+    if (font == 0) return -4;
+    if (len == 0) return 0;
+
+    const uint32_t right = (uint32_t)x + (uint32_t)len * font - 1;
+    const uint16_t clip_right = (right > UINT16_MAX) ? UINT16_MAX : (uint16_t)right;
+    const uint16_t clip_bottom = ((uint32_t)y + font - 1 > UINT16_MAX) ? UINT16_MAX : y + font - 1;
+
+    for (uint8_t i = 0; i < g_canvas.count; i++) {
+        ssd1681_canvas_slot_t *s = &g_canvas.slots[i];
+        canvas_clip_t c;
+        if (!canvas_clip(&s->tile, x, y, clip_right, clip_bottom, &c)) continue;
+        if (!canvas_select(s, color)) continue;
+
+        /* The core clips glyphs that start on a neighbouring tile */
+        ssd1681_draw_text_at(color, (int16_t)((int32_t)x - s->tile.x), (int16_t)((int32_t)y - s->tile.y),
+                             str, len, data, font);
+    }
+    return 0;
+}
+
+/**
+ * @brief Upload every changed tile and start all their refreshes
+ */
+int ssd1681_canvas_flush(uint8_t update_type)
+{
+    if (g_canvas.count == 0) return -1;
+
+    /* Multi-pass types wait for BUSY between passes, which would serialize the tiles */
+    if (update_type == SSD1681_UPDATE_FAST_FULL || update_type == SSD1681_UPDATE_CLEAN_FULL_AGGRESSIVE) return -3;
+    if (update_type > SSD1681_UPDATE_CLEAN_FULL_AGGRESSIVE) return -2;
+
+    bool any = false;
+
+    /* Each update returns once the refresh is started, so the BUSY periods overlap */
+    for (uint8_t i = 0; i < g_canvas.count; i++) {
+        ssd1681_canvas_slot_t *s = &g_canvas.slots[i];
+        if (!s->dirty) continue;
+
+        ssd1681_bind_panel(&s->tile.config);
+        ssd1681_set_framebuffers(s->tile.black, s->tile.red);
+
+        int ret = ssd1681_write_buffer(SSD1681_COLOR_BLACK);
+        if (ret != 0) return ret;
+        if (s->tile.red) {
+            ssd1681_write_buffer(SSD1681_COLOR_RED);
+        }
+
+        ret = ssd1681_update(update_type);
+        if (ret != 0) return ret;
+
+        s->dirty = false;
+        any = true;
+    }
+
+    return any ? 0 : 1;
+}
+
+/**
+ * @brief Check whether any tile is still refreshing
+ */
+bool ssd1681_canvas_busy(void)
+{
+    for (uint8_t i = 0; i < g_canvas.count; i++) {
+        if (gpio_get(g_canvas.slots[i].tile.config.pin_busy)) return true;
+    }
+    return false;
+}
+
+/**
+ * @brief Wait until every tile has finished refreshing
+ */
+void ssd1681_canvas_wait(void)
+{
+    while (ssd1681_canvas_busy()) {
+        sleep_us(100);
+    }
+}
@@ -0,0 +1,110 @@
+/**
+ * SSD1681 Tiled Canvas
+ * One drawing surface spanning several panels, refreshed in parallel
+ *
+ * Copyright (c) 2026 OpenCode
+ * SPDX-License-Identifier: MIT
+ */
+
+#ifndef PICO_SSD1681_CANVAS_H
+#define PICO_SSD1681_CANVAS_H
+
+#include "pico_ssd1681.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief Number of panels in a canvas, fixed at compile time
+ */
+#ifndef SSD1681_CANVAS_MAX_TILES
+#define SSD1681_CANVAS_MAX_TILES 4
+#endif
+
+/**
+ * @brief One panel of the canvas
+ */
+typedef struct {
+    ssd1681_config_t config;  /**< Pins; tiles share an SPI port with their own CS/BUSY, or use spi0/spi1 */
+    uint16_t x;               /**< Left edge on the canvas */
+    uint16_t y;               /**< Top edge on the canvas */
+    uint8_t *black;           /**< Black plane (SSD1681_PLANE_SIZE bytes), app-owned */
+    uint8_t *red;             /**< Red plane, NULL if the tile has no red content */
+} ssd1681_canvas_tile_t;
+
+/**
+ * @brief Initialize all panels of a canvas
+ * @param tiles Tile descriptions, copied
+ * @param count Number of tiles (1..SSD1681_CANVAS_MAX_TILES)
+ * @return 0 on success, negative on error
+ * @note Replaces ssd1681_init(). Planes are cleared to white. Build with
+ *       SSD1681_EXTERNAL_FRAMEBUFFER, the internal planes are not used by a canvas.
+ */
+int ssd1681_canvas_init(const ssd1681_canvas_tile_t *tiles, uint8_t count);
+
+/**
+ * @brief Canvas size, the bounding box of all tiles
+ */
+void ssd1681_canvas_get_size(uint16_t *width, uint16_t *height);
+
+/**
+ * @brief Clear a color on all tiles
+ * @return 0 on success
+ */
+int ssd1681_canvas_clear(ssd1681_color_t color);
+
+/**
+ * @brief Draw a pixel in canvas coordinates
+ * @return 0 on success, -2 if outside every tile
+ */
+int ssd1681_canvas_write_point(ssd1681_color_t color, uint16_t x, uint16_t y, uint8_t data);
+
+/**
+ * @brief Fill a rectangle in canvas coordinates, clipped per tile
+ * @return 0 on success
+ */
+int ssd1681_canvas_fill_rect(ssd1681_color_t color, uint16_t left, uint16_t top,
+                             uint16_t right, uint16_t bottom, uint8_t data);
+
+/**
+ * @brief Draw an image (same format as ssd1681_draw_picture()) in canvas coordinates
+ * @return 0 on success
+ */
+int ssd1681_canvas_draw_picture(ssd1681_color_t color, uint16_t left, uint16_t top,
+                                uint16_t right, uint16_t bottom, const uint8_t *img);
+
+/**
+ * @brief Draw one line of text in canvas coordinates, glyphs may straddle tiles
+ * @return 0 on success
+ */
+int ssd1681_canvas_draw_text(ssd1681_color_t color, uint16_t x, uint16_t y,
+                             const char *str, uint16_t len, uint8_t data, uint8_t font);
+
+/**
+ * @brief Upload every changed tile and start all their refreshes
+ * @param update_type SSD1681_UPDATE_FAST_PARTIAL or SSD1681_UPDATE_CLEAN_FULL
+ * @return 0 if refreshes were started, 1 if nothing changed, -1 if no canvas, -2 for an
+ *         invalid update type, -3 for FAST_FULL and CLEAN_FULL_AGGRESSIVE (nothing is uploaded),
+ *         other negative values on upload error
+ * @note Returns without waiting: all tiles refresh at the same time, so a sign update takes
+ *       one panel refresh. A tile still busy from the previous flush is waited for first.
+ *       The multi-pass types wait for BUSY between passes, so they are not supported here.
+ */
+int ssd1681_canvas_flush(uint8_t update_type);
+
+/**
+ * @brief Check whether any tile is still refreshing
+ */
+bool ssd1681_canvas_busy(void);
+
+/**
+ * @brief Wait until every tile has finished refreshing
+ */
+void ssd1681_canvas_wait(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* pico_ssd1681_canvas.h */
@@ -0,0 +1,221 @@
+/**
+ * SSD1681 Scrolling Console
+ * Log/terminal output in text rows kept as a ring over the black plane
+ *
+ * Copyright (c) 2026 OpenCode
+ * SPDX-License-Identifier: MIT
+ */
+
+#include "pico_ssd1681_console.h"
+
+#include <string.h>
+
+#define PLANE_ROW_OFFSET(y) ((uint32_t)(SSD1681_PANEL_HEIGHT - 1 - (y)) * SSD1681_PLANE_STRIDE)
+
+static struct {
+    bool active;
+    uint8_t font;
+    uint16_t rows;          /* Text rows in the ring */
+    uint16_t columns;
+    uint16_t origin;        /* Ring slot holding the top text row */
+    uint16_t line;          /* Text row of the cursor, 0 = top */
+    uint16_t column;
+    bool newline_pending;   /* '\n' seen, the line is started by the next character */
+    bool scrolled;          /* Origin moved since the last flush, every row must be sent */
+    bool dirty;
+    uint16_t dirty_first;   /* Text rows changed since the last flush (without a scroll) */
+    uint16_t dirty_last;
+} g_console = {0};
+
+/**
+ * @brief Fill the ring slot of a text row with white
+ */
+static void console_clear_line(uint8_t *plane, uint16_t line)
+{
+    const uint16_t slot = (g_console.origin + line) % g_console.rows;
+    const uint16_t last = slot * g_console.font + g_console.font - 1;
+
+    /* The slot's pixel rows are one contiguous byte range in the bottom-up plane */
+    memset(plane + PLANE_ROW_OFFSET(last), 0xFF, (uint32_t)g_console.font * SSD1681_PLANE_STRIDE);
+}
+
+static void console_mark(uint16_t line)
+{
+    if (!g_console.dirty || line < g_console.dirty_first) g_console.dirty_first = line;
+    if (!g_console.dirty || line > g_console.dirty_last) g_console.dirty_last = line;
+    g_console.dirty = true;
+}
+
+/**
+ * @brief Move the cursor to the start of the next text row, scrolling when at the bottom
+ */
+static void console_newline(uint8_t *plane)
+{
+    g_console.column = 0;
+    g_console.newline_pending = false;
+
+    if (g_console.line + 1 < g_console.rows) {
+        g_console.line++;
+    } else {
+        /* The top row's slot becomes the new bottom row */
+        g_console.origin = (g_console.origin + 1) % g_console.rows;
+        g_console.scrolled = true;
+    }
+
+    console_clear_line(plane, g_console.line);
+    console_mark(g_console.line);
+}
+
+/**
+ * @brief Send screen rows first..last to display RAM from their ring positions
+ */
+static int console_upload(const uint8_t *plane, uint16_t first, uint16_t last)
+{
+    const uint16_t ring = g_console.rows * g_console.font;
+    const uint16_t start = (first + g_console.origin * g_console.font) % ring;
+    const uint16_t count = last - first + 1;
+    const uint16_t run = (count < ring - start) ? count : ring - start;
+
+    /* Moving up one screen row moves one row back in the bottom-up plane */
+    int ret = ssd1681_write_region(SSD1681_COLOR_BLACK, 0, first, SSD1681_PANEL_WIDTH - 1, first + run - 1,
+                                   plane + PLANE_ROW_OFFSET(start), -SSD1681_PLANE_STRIDE);
+    if (ret != 0 || run == count) return ret;
+
+    /* The rest wrapped around to the start of the ring */
+    return ssd1681_write_region(SSD1681_COLOR_BLACK, 0, first + run, SSD1681_PANEL_WIDTH - 1, last,
+                                plane + PLANE_ROW_OFFSET(0), -SSD1681_PLANE_STRIDE);
+}
+
+/**
+ * @brief Start a console on the active black plane
+ */
+int ssd1681_console_init(uint8_t font)
+{
+    /* Compared as uint16_t: a uint8_t compare warns (-Wtype-limits) on panels over 255 pixels */
+    const uint16_t size = font;
+    if (size == 0 || size > SSD1681_PANEL_HEIGHT || size > SSD1681_PANEL_WIDTH) return -4;
+    if (!ssd1681_get_framebuffer(SSD1681_COLOR_BLACK)) return -1;
+
+    memset(&g_console, 0, sizeof(g_console));
+    g_console.font = font;
+    g_console.rows = SSD1681_PANEL_HEIGHT / font;
+    g_console.columns = SSD1681_PANEL_WIDTH / font;
+    g_console.active = true;
+
+    return ssd1681_console_clear();
+}
+
+/**
+ * @brief Append text
+ */
+int ssd1681_console_write(const char *str, uint16_t len)
+{
+    if (!g_console.active) return -1;
+    if (!str) return -2;
+
+    uint8_t *plane = ssd1681_get_framebuffer(SSD1681_COLOR_BLACK);
+    if (!plane) return -1;
+
+    uint16_t i = 0;
+    while (i < len) {
+        if (str[i] == '\n') {
+            if (g_console.newline_pending) console_newline(plane);
+            g_console.newline_pending = true;
+            i++;
+            continue;
+        }
+        if (str[i] == '\r') {
+            i++;
+            continue;
+        }
+
+        if (g_console.newline_pending || g_console.column == g_console.columns) {
+            console_newline(plane);
+        }
+
+        /* Draw the characters up to the next control character or the end of the row in one run */
+        uint16_t n = 0;
+        while (i + n < len && str[i + n] != '\n' && str[i + n] != '\r' &&
+               g_console.column + n < g_console.columns) {
+            n++;
+        }
+
+        const uint16_t slot = (g_console.origin + g_console.line) % g_console.rows;
+        ssd1681_draw_text_at(SSD1681_COLOR_BLACK, (int16_t)(g_console.column * g_console.font),
+                             (int16_t)(slot * g_console.font), &str[i], n, 1, g_console.font);
+        console_mark(g_console.line);
+
+        g_console.column += n;
+        i += n;
+    }
+
+    return 0;
+}
+
+/**
+ * @brief Append a NUL-terminated string
+ */
+int ssd1681_console_print(const char *str)
+{
+    if (!str) return -2;
+    return ssd1681_console_write(str, (uint16_t)strlen(str));
+}
+
+/**
+ * @brief Clear the console
+ */
+int ssd1681_console_clear(void)
+{
+    if (!g_console.active) return -1;
+
+    uint8_t *plane = ssd1681_get_framebuffer(SSD1681_COLOR_BLACK);
+    if (!plane) return -1;
+
+    for (uint16_t line = 0; line < g_console.rows; line++) {
+        console_clear_line(plane, line);
+    }
+
+    g_console.origin = 0;
+    g_console.line = 0;
+    g_console.column = 0;
+    g_console.newline_pending = false;
+    g_console.scrolled = true;  /* Whole console must be sent */
+
+    return 0;
+}
+
+/**
+ * @brief Console size in characters
+ */
+void ssd1681_console_get_size(uint16_t *columns, uint16_t *rows)
+{
+    if (columns) *columns = g_console.columns;
+    if (rows) *rows = g_console.rows;
+}
+
+/**
+ * @brief Upload what changed since the last flush and refresh
+ */
+int ssd1681_console_flush(uint8_t update_type)
+{
+    if (!g_console.active) return -1;
+    if (!g_console.scrolled && !g_console.dirty) return 1;
+
+    const uint8_t *plane = ssd1681_get_framebuffer(SSD1681_COLOR_BLACK);
+    if (!plane) return -1;
+
+    uint16_t first = 0;
+    uint16_t last = g_console.rows - 1;
+    if (!g_console.scrolled) {
+        first = g_console.dirty_first;
+        last = g_console.dirty_last;
+    }
+
+    int ret = console_upload(plane, first * g_console.font, (last + 1) * g_console.font - 1);
+    if (ret != 0) return ret;
+
+    g_console.scrolled = false;
+    g_console.dirty = false;
+
+    return ssd1681_update(update_type);
+}
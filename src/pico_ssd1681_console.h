@@ -0,0 +1,76 @@
+/**
+ * SSD1681 Scrolling Console
+ * Log/terminal output in text rows kept as a ring over the black plane
+ *
+ * Copyright (c) 2026 OpenCode
+ * SPDX-License-Identifier: MIT
+ */
+
+#ifndef PICO_SSD1681_CONSOLE_H
+#define PICO_SSD1681_CONSOLE_H
+
+#include "pico_ssd1681.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*
+ * The black plane is split into text rows of font pixels. Text rows are used as a ring:
+ * scrolling only moves the ring origin and clears the recycled row, so a new line costs
+ * one text row of rendering. ssd1681_console_flush() streams the plane to display RAM in
+ * rotated order (two RAM windows at most), so the panel shows the rows in logical order.
+ *
+ * While the console is active the plane is in ring order, not screen order: upload it with
+ * ssd1681_console_flush(), not ssd1681_write_buffer(). Rows below the last text row
+ * (SSD1681_PANEL_HEIGHT % font) are left untouched.
+ */
+
+/**
+ * @brief Start a console on the active black plane
+ * @param font Font size as for ssd1681_draw_text_at() (FONT_SIZE_8 etc.)
+ * @return 0 on success, -1 if not initialized or no plane, -4 if the font is 0 or larger than the panel
+ * @note Clears the plane.
+ */
+int ssd1681_console_init(uint8_t font);
+
+/**
+ * @brief Append text
+ * @param str Characters, '\n' starts a new line, '\r' is ignored
+ * @param len Number of characters
+ * @return 0 on success, -1 if the console is not started, -2 for a NULL string
+ * @note Lines wrap at the panel width. Once every text row is used, each new line scrolls
+ *       the console up by one text row.
+ */
+int ssd1681_console_write(const char *str, uint16_t len);
+
+/**
+ * @brief Append a NUL-terminated string
+ */
+int ssd1681_console_print(const char *str);
+
+/**
+ * @brief Clear the console and move to the first row
+ * @return 0 on success, -1 if the console is not started
+ */
+int ssd1681_console_clear(void);
+
+/**
+ * @brief Console size in characters
+ */
+void ssd1681_console_get_size(uint16_t *columns, uint16_t *rows);
+
+/**
+ * @brief Upload what changed since the last flush and refresh
+ * @param update_type Update type passed to ssd1681_update()
+ * @return 0 if a refresh was started, 1 if nothing changed, negative on error
+ * @note Without a scroll only the changed text rows are sent; after a scroll the whole
+ *       console is sent, straight from the ring with no re-rendering.
+ */
+int ssd1681_console_flush(uint8_t update_type);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* pico_ssd1681_console.h */
@@ -0,0 +1,272 @@
+/**
+ * SSD1681 Layer Compositing
+ * Fixed set of 1bpp layers with masks, combined into the planes at flush time
+ *
+ * Copyright (c) 2026 OpenCode
+ * SPDX-License-Identifier: MIT
+ */
+
+#include "pico_ssd1681_layers.h"
+
+#include <string.h>
+
+/* Word view of plane bytes; may_alias keeps word access to byte buffers well-defined */
+typedef uint32_t __attribute__((may_alias)) layer_word_t;
+
+#define PLANE_ROW_OFFSET(y) ((uint32_t)(SSD1681_PANEL_HEIGHT - 1 - (y)) * SSD1681_PLANE_STRIDE)
+
+typedef struct {
+    const uint8_t *pixels;
+    const uint8_t *mask;
+    uint8_t color;
+    uint8_t rop;
+    bool visible;
+    uint16_t top;
+    uint16_t bottom;
+} ssd1681_layer_t;
+
+/* Rows waiting to be recomposited, per plane */
+typedef struct {
+    bool dirty;
+    uint16_t top;
+    uint16_t bottom;
+} ssd1681_dirty_rows_t;
+
+static struct {
+    ssd1681_layer_t layers[SSD1681_LAYER_MAX];
+    ssd1681_dirty_rows_t dirty[2];  /* Indexed by ssd1681_color_t */
+} g_layers = {0};
+
+static void layers_mark_dirty(uint8_t color, uint16_t top, uint16_t bottom)
+{
+    ssd1681_dirty_rows_t *d = &g_layers.dirty[color ? 1 : 0];
+
+    if (!d->dirty) {
+        d->dirty = true;
+        d->top = top;
+        d->bottom = bottom;
+        return;
+    }
+    if (top < d->top) d->top = top;
+    if (bottom > d->bottom) d->bottom = bottom;
+}
+
+static ssd1681_layer_t *layers_get(uint8_t layer)
+{
+    if (layer >= SSD1681_LAYER_MAX || !g_layers.layers[layer].pixels) return NULL;
+    return &g_layers.layers[layer];
+}
+
+/**
+ * @brief Combine one word (or byte) in native polarity, where a cleared bit is ink
+ */
+static inline uint32_t layers_rop(uint32_t d, uint32_t s, uint32_t m, uint8_t rop)
+{
+    switch (rop) {
+        case SSD1681_ROP_OR:  return d & (s | ~m);
+        case SSD1681_ROP_AND: return d | (s & m);
+        case SSD1681_ROP_XOR: return d ^ (~s & m);
+        default:              return (d & ~m) | (s & m);
+    }
+}
+
+/**
+ * @brief Apply a layer to plane bytes [start, end), a word at a time where alignment allows
+ */
+static inline __attribute__((always_inline))
+void layers_rop_span(uint8_t *dst, const uint8_t *src, const uint8_t *mask,
+                     uint32_t start, uint32_t end, uint8_t rop)
+{
+    uint32_t i = start;
+    const bool aligned = (((uintptr_t)dst ^ (uintptr_t)src) & 3) == 0 &&
+                         (!mask || (((uintptr_t)dst ^ (uintptr_t)mask) & 3) == 0);
+
+    if (aligned) {
+        for (; i < end && ((uintptr_t)&dst[i] & 3); i++) {
+            dst[i] = layers_rop(dst[i], src[i], mask ? mask[i] : 0xFF, rop);
+        }
+        for (; i + 4 <= end; i += 4) {
+            layer_word_t *d = (layer_word_t *)&dst[i];
+            *d = layers_rop(*d, *(const layer_word_t *)&src[i],
+                            mask ? *(const layer_word_t *)&mask[i] : 0xFFFFFFFF, rop);
+        }
+    }
+    for (; i < end; i++) {
+        dst[i] = layers_rop(dst[i], src[i], mask ? mask[i] : 0xFF, rop);
+    }
+}
+
+static void layers_apply(uint8_t *dst, const ssd1681_layer_t *l, uint32_t start, uint32_t end)
+{
+    /* Constant rop per call so each loop is specialised */
+    switch (l->rop) {
+        case SSD1681_ROP_OR:  layers_rop_span(dst, l->pixels, l->mask, start, end, SSD1681_ROP_OR); break;
+        case SSD1681_ROP_AND: layers_rop_span(dst, l->pixels, l->mask, start, end, SSD1681_ROP_AND); break;
+        case SSD1681_ROP_XOR: layers_rop_span(dst, l->pixels, l->mask, start, end, SSD1681_ROP_XOR); break;
+        default:              layers_rop_span(dst, l->pixels, l->mask, start, end, SSD1681_ROP_COPY); break;
+    }
+}
+
+/**
+ * @brief Attach a layer
+ */
+int ssd1681_layer_attach(uint8_t layer, ssd1681_color_t color, const uint8_t *pixels,
+                         const uint8_t *mask, ssd1681_rop_t rop, uint16_t top, uint16_t bottom)
+{
+    if (layer >= SSD1681_LAYER_MAX) return -1;
+    if (!pixels) return -2;
+    if (top > bottom || bottom >= SSD1681_PANEL_HEIGHT) return -3;
+    if (rop > SSD1681_ROP_XOR) return -4;
+
+    ssd1681_layer_t *l = &g_layers.layers[layer];
+    if (l->pixels && l->visible) {
+        layers_mark_dirty(l->color, l->top, l->bottom);
+    }
+
+    l->pixels = pixels;
+    l->mask = mask;
+    l->color = color;
+    l->rop = rop;
+    l->visible = true;
+    l->top = top;
+    l->bottom = bottom;
+    layers_mark_dirty(color, top, bottom);
+
+    return 0;
+}
+
+/**
+ * @brief Detach a layer
+ */
+int ssd1681_layer_detach(uint8_t layer)
+{
+    ssd1681_layer_t *l = layers_get(layer);
+    if (!l) return -1;
+
+    layers_mark_dirty(l->color, l->top, l->bottom);
+    memset(l, 0, sizeof(*l));
+
+    return 0;
+}
+
+/**
+ * @brief Show or hide a layer
+ */
+int ssd1681_layer_set_visible(uint8_t layer, bool visible)
+{
+    ssd1681_layer_t *l = layers_get(layer);
+    if (!l) return -1;
+
+    if (l->visible != visible) {
+        l->visible = visible;
+        layers_mark_dirty(l->color, l->top, l->bottom);
+    }
+    return 0;
+}
+
+/**
+ * @brief Change a layer's raster operation
+ */
+int ssd1681_layer_set_rop(uint8_t layer, ssd1681_rop_t rop)
+{
+    ssd1681_layer_t *l = layers_get(layer);
+    if (!l) return -1;
+    if (rop > SSD1681_ROP_XOR) return -4;
+
+    if (l->rop != rop) {
+        l->rop = rop;
+        if (l->visible) layers_mark_dirty(l->color, l->top, l->bottom);
+    }
+    return 0;
+}
+
+/**
+ * @brief Mark rows of a layer as changed
+ */
+int ssd1681_layer_invalidate(uint8_t layer, uint16_t top, uint16_t bottom)
+{
+    ssd1681_layer_t *l = layers_get(layer);
+    if (!l) return -1;
+    if (top > bottom) return -3;
+
+    /* Only rows inside the layer's extent can change the output */
+    if (top < l->top) top = l->top;
+    if (bottom > l->bottom) bottom = l->bottom;
+    if (l->visible && top <= bottom) {
+        layers_mark_dirty(l->color, top, bottom);
+    }
+    return 0;
+}
+
+/**
+ * @brief Composite changed rows
+ */
+int ssd1681_layers_composite(uint16_t *top, uint16_t *bottom)
+{
+    bool any = false;
+    uint16_t out_top = 0;
+    uint16_t out_bottom = 0;
+
+    for (uint8_t color = 0; color < 2; color++) {
+        ssd1681_dirty_rows_t *d = &g_layers.dirty[color];
+        if (!d->dirty) continue;
+
+        uint8_t *plane = ssd1681_get_framebuffer((ssd1681_color_t)color);
+        if (!plane) {
+            d->dirty = false;
+            continue;
+        }
+
+        /* Rows top..bottom are one contiguous byte range in the bottom-up plane */
+        const uint32_t start = PLANE_ROW_OFFSET(d->bottom);
+        const uint32_t end = PLANE_ROW_OFFSET(d->top) + SSD1681_PLANE_STRIDE;
+
+        memset(plane + start, 0xFF, end - start);
+
+        for (uint8_t i = 0; i < SSD1681_LAYER_MAX; i++) {
+            const ssd1681_layer_t *l = &g_layers.layers[i];
+            if (!l->pixels || !l->visible || l->color != color) continue;
+
+            uint32_t ls = PLANE_ROW_OFFSET(l->bottom);
+            uint32_t le = PLANE_ROW_OFFSET(l->top) + SSD1681_PLANE_STRIDE;
+            if (ls < start) ls = start;
+            if (le > end) le = end;
+            if (ls < le) {
+                layers_apply(plane, l, ls, le);
+            }
+        }
+
+        if (!any || d->top < out_top) out_top = d->top;
+        if (!any || d->bottom > out_bottom) out_bottom = d->bottom;
+        any = true;
+        d->dirty = false;
+    }
+
+    if (!any) return 1;
+
+    if (top) *top = out_top;
+    if (bottom) *bottom = out_bottom;
+    return 0;
+}
+
+/**
+ * @brief Composite, send the changed rows, then refresh
+ */
+int ssd1681_layers_flush(uint8_t update_type)
+{
+    bool red_dirty = g_layers.dirty[SSD1681_COLOR_RED].dirty;
+    uint16_t top;
+    uint16_t bottom;
+
+    int ret = ssd1681_layers_composite(&top, &bottom);
+    if (ret != 0) return ret;
+
+    ret = ssd1681_write_buffer_region(SSD1681_COLOR_BLACK, 0, top, SSD1681_PANEL_WIDTH - 1, bottom);
+    if (ret != 0) return ret;
+
+    if (red_dirty) {
+        ssd1681_write_buffer_region(SSD1681_COLOR_RED, 0, top, SSD1681_PANEL_WIDTH - 1, bottom);
+    }
+
+    return ssd1681_update(update_type);
+}
@@ -0,0 +1,84 @@
+/**
+ * SSD1681 Layer Compositing
+ * Fixed set of 1bpp layers with masks, combined into the planes at flush time
+ *
+ * Copyright (c) 2026 OpenCode
+ * SPDX-License-Identifier: MIT
+ */
+
+#ifndef PICO_SSD1681_LAYERS_H
+#define PICO_SSD1681_LAYERS_H
+
+#include "pico_ssd1681.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief Number of layers, fixed at compile time
+ */
+#ifndef SSD1681_LAYER_MAX
+#define SSD1681_LAYER_MAX 4
+#endif
+
+/**
+ * @brief Attach a layer
+ * @param layer Layer index, layers are composited in ascending order on a white background
+ * @param color Plane the layer is composited into
+ * @param pixels Layer pixels in controller-native layout (SSD1681_PLANE_SIZE bytes), must stay valid
+ * @param mask Coverage in the same layout, 1=layer applies; NULL covers the whole layer
+ * @param rop Raster operation
+ * @param top First row the layer contributes to
+ * @param bottom Last row the layer contributes to
+ * @return 0 on success
+ * @note Buffers aligned to 4 bytes are combined a word at a time. The app can draw into a layer
+ *       with the normal primitives after binding it with ssd1681_set_framebuffers().
+ */
+int ssd1681_layer_attach(uint8_t layer, ssd1681_color_t color, const uint8_t *pixels,
+                         const uint8_t *mask, ssd1681_rop_t rop, uint16_t top, uint16_t bottom);
+
+/**
+ * @brief Detach a layer, its rows are recomposited on the next flush
+ * @return 0 on success
+ */
+int ssd1681_layer_detach(uint8_t layer);
+
+/**
+ * @brief Show or hide a layer
+ * @return 0 on success
+ */
+int ssd1681_layer_set_visible(uint8_t layer, bool visible);
+
+/**
+ * @brief Change a layer's raster operation
+ * @return 0 on success
+ */
+int ssd1681_layer_set_rop(uint8_t layer, ssd1681_rop_t rop);
+
+/**
+ * @brief Mark rows of a layer as changed after drawing into its pixels or mask
+ * @return 0 on success
+ */
+int ssd1681_layer_invalidate(uint8_t layer, uint16_t top, uint16_t bottom);
+
+/**
+ * @brief Composite changed rows into the black/red planes
+ * @param top Output: first recomposited row (may be NULL)
+ * @param bottom Output: last recomposited row (may be NULL)
+ * @return 0 if rows were recomposited, 1 if nothing changed, negative on error
+ */
+int ssd1681_layers_composite(uint16_t *top, uint16_t *bottom);
+
+/**
+ * @brief Composite, send the changed rows to display RAM, then refresh
+ * @param update_type Update type passed to ssd1681_update()
+ * @return 0 on refresh, 1 if nothing changed, negative on error
+ */
+int ssd1681_layers_flush(uint8_t update_type);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* pico_ssd1681_layers.h */
@@ -0,0 +1,206 @@
+/**
+ * SSD1681 Page Cache
+ * Composed frames kept RLE-compressed in an app-owned arena for instant page switching
+ *
+ * Copyright (c) 2026 OpenCode
+ * SPDX-License-Identifier: MIT
+ */
+
+#include "pico_ssd1681_pages.h"
+
+#include <string.h>
+
+/* Shortest run stored as a repeat token, shorter runs stay in literals */
+#define PAGE_MIN_RUN 3
+
+typedef struct {
+    bool used;
+    uint32_t offset;     /* Start in the arena */
+    uint32_t black_len;  /* Black tokens, followed by red_len red tokens */
+    uint32_t red_len;
+} page_slot_t;
+
+static struct {
+    uint8_t *arena;
+    uint32_t size;
+    uint32_t used;
+    page_slot_t slots[SSD1681_PAGE_MAX];
+} g_pages = {0};
+
+/**
+ * @brief RLE-encode a plane into dst, same tokens as rle_tokens() in tools/ssd1681_codec.py
+ * @return Bytes written, 0 if dst is too small
+ */
+static uint32_t page_encode(uint8_t *dst, uint32_t space, const uint8_t *src, uint32_t len)
+{
+    uint32_t o = 0;
+    uint32_t i = 0;
+
+    while (i < len) {
+        uint32_t run = 1;
+        while (i + run < len && run < 128 && src[i + run] == src[i]) run++;
+
+        if (run >= PAGE_MIN_RUN) {
+            if (o + 2 > space) return 0;
+            dst[o++] = 0x80 | (run - 1);
+            dst[o++] = src[i];
+            i += run;
+            continue;
+        }
+
+        /* Literals up to the next run worth a repeat token */
+        uint32_t start = i;
+        while (i < len && i - start < 128) {
+            if (i + PAGE_MIN_RUN <= len && src[i] == src[i + 1] && src[i] == src[i + 2]) break;
+            i++;
+        }
+        const uint32_t n = i - start;
+        if (o + 1 + n > space) return 0;
+        dst[o++] = n - 1;
+        memcpy(&dst[o], &src[start], n);
+        o += n;
+    }
+
+    return o;
+}
+
+/**
+ * @brief Use an arena for the page cache
+ */
+int ssd1681_pages_init(uint8_t *arena, uint32_t size)
+{
+    if (!arena) return -2;
+
+    memset(&g_pages, 0, sizeof(g_pages));
+    g_pages.arena = arena;
+    g_pages.size = size;
+
+    return 0;
+}
+
+/**
+ * @brief Compress the active planes into a page slot
+ */
+int ssd1681_page_store(uint8_t page)
+{
+    if (!g_pages.arena) return -1;
+    if (page >= SSD1681_PAGE_MAX) return -2;
+
+    const uint8_t *black = ssd1681_get_framebuffer(SSD1681_COLOR_BLACK);
+    const uint8_t *red = ssd1681_get_framebuffer(SSD1681_COLOR_RED);
+    if (!black) return -1;
+
+    /* Free first so the old copy's space can be reused */
+    ssd1681_page_free(page);
+
+    page_slot_t *s = &g_pages.slots[page];
+    uint8_t *dst = g_pages.arena + g_pages.used;
+    const uint32_t space = g_pages.size - g_pages.used;
+
+    s->black_len = page_encode(dst, space, black, SSD1681_PLANE_SIZE);
+    if (s->black_len == 0) return -3;
+
+    s->red_len = 0;
+    if (red) {
+        s->red_len = page_encode(dst + s->black_len, space - s->black_len, red, SSD1681_PLANE_SIZE);
+        if (s->red_len == 0) return -3;
+    }
+
+    s->offset = g_pages.used;
+    s->used = true;
+    g_pages.used += s->black_len + s->red_len;
+
+    return 0;
+}
+
+/**
+ * @brief Decompress a page into the active planes
+ */
+int ssd1681_page_load(uint8_t page)
+{
+    if (!g_pages.arena) return -1;
+    if (page >= SSD1681_PAGE_MAX || !g_pages.slots[page].used) return -2;
+
+    const page_slot_t *s = &g_pages.slots[page];
+    uint8_t *black = ssd1681_get_framebuffer(SSD1681_COLOR_BLACK);
+    uint8_t *red = ssd1681_get_framebuffer(SSD1681_COLOR_RED);
+    if (!black) return -1;
+
+    const uint8_t *tokens = g_pages.arena + s->offset;
+    int ret = ssd1681_rle_decode(black, SSD1681_PLANE_STRIDE, SSD1681_PLANE_STRIDE, SSD1681_PLANE_SIZE,
+                                 tokens, s->black_len);
+    if (ret != 0) return ret;
+
+    if (red) {
+        if (s->red_len) {
+            ret = ssd1681_rle_decode(red, SSD1681_PLANE_STRIDE, SSD1681_PLANE_STRIDE, SSD1681_PLANE_SIZE,
+                                     tokens + s->black_len, s->red_len);
+            if (ret != 0) return ret;
+        } else {
+            memset(red, 0xFF, SSD1681_PLANE_SIZE);  /* Stored from a build without red content */
+        }
+    }
+
+    return 0;
+}
+
+/**
+ * @brief Switch to a page
+ */
+int ssd1681_page_show(uint8_t page, uint8_t update_type)
+{
+    int ret = ssd1681_page_load(page);
+    if (ret != 0) return ret;
+
+    ret = ssd1681_write_buffer(SSD1681_COLOR_BLACK);
+    if (ret != 0) return ret;
+    if (ssd1681_get_framebuffer(SSD1681_COLOR_RED)) {
+        ret = ssd1681_write_buffer(SSD1681_COLOR_RED);
+        if (ret != 0) return ret;
+    }
+
+    return ssd1681_update(update_type);
+}
+
+/**
+ * @brief Empty a page slot and compact the arena
+ */
+int ssd1681_page_free(uint8_t page)
+{
+    if (page >= SSD1681_PAGE_MAX) return -2;
+
+    page_slot_t *s = &g_pages.slots[page];
+    if (!s->used) return 0;
+
+    /* Slide the pages stored after it down over the hole */
+    const uint32_t len = s->black_len + s->red_len;
+    const uint32_t end = s->offset + len;
+    memmove(g_pages.arena + s->offset, g_pages.arena + end, g_pages.used - end);
+    g_pages.used -= len;
+
+    for (uint8_t i = 0; i < SSD1681_PAGE_MAX; i++) {
+        if (g_pages.slots[i].used && g_pages.slots[i].offset > s->offset) {
+            g_pages.slots[i].offset -= len;
+        }
+    }
+
+    memset(s, 0, sizeof(*s));
+    return 0;
+}
+
+/**
+ * @brief Compressed size of a page
+ */
+uint32_t ssd1681_page_size(uint8_t page)
+{
+    if (page >= SSD1681_PAGE_MAX || !g_pages.slots[page].used) return 0;
+    return g_pages.slots[page].black_len + g_pages.slots[page].red_len;
+}
+
+/**
+ * @brief Arena bytes in use
+ */
+uint32_t ssd1681_pages_used(void)
+{
+    return g_pages.used;
+}
@@ -0,0 +1,81 @@
+/**
+ * SSD1681 Page Cache
+ * Composed frames kept RLE-compressed in an app-owned arena for instant page switching
+ *
+ * Copyright (c) 2026 OpenCode
+ * SPDX-License-Identifier: MIT
+ */
+
+#ifndef PICO_SSD1681_PAGES_H
+#define PICO_SSD1681_PAGES_H
+
+#include "pico_ssd1681.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief Number of page slots, fixed at compile time
+ */
+#ifndef SSD1681_PAGE_MAX
+#define SSD1681_PAGE_MAX 8
+#endif
+
+/*
+ * Pages are stored as the run-length tokens of assets (see ssd1681_asset_encoding_t).
+ * Mostly white UI frames shrink to a few hundred bytes.
+ */
+
+/**
+ * @brief Use an arena for the page cache, dropping all stored pages
+ * @param arena Storage for compressed pages, app-owned, must stay valid
+ * @param size Arena size in bytes
+ * @return 0 on success, -2 for a NULL arena
+ */
+int ssd1681_pages_init(uint8_t *arena, uint32_t size);
+
+/**
+ * @brief Compress the active planes into a page slot, replacing what it held
+ * @param page Slot (0..SSD1681_PAGE_MAX-1)
+ * @return 0 on success, -1 if not initialized, -2 for a bad slot, -3 if the arena is full
+ *         (the slot is left empty)
+ */
+int ssd1681_page_store(uint8_t page);
+
+/**
+ * @brief Decompress a page straight into the active planes
+ * @return 0 on success, -1 if not initialized, -2 for a bad or empty slot, -5 if the stored
+ *         tokens are damaged (arena overwritten)
+ */
+int ssd1681_page_load(uint8_t page);
+
+/**
+ * @brief Switch to a page: decompress into the planes, upload and refresh, no re-render
+ * @param page Slot
+ * @param update_type Update type passed to ssd1681_update()
+ * @return 0 on success, negative on error
+ */
+int ssd1681_page_show(uint8_t page, uint8_t update_type);
+
+/**
+ * @brief Empty a page slot and compact the arena
+ * @return 0 on success, -2 for a bad slot
+ */
+int ssd1681_page_free(uint8_t page);
+
+/**
+ * @brief Compressed size of a page, 0 if the slot is empty
+ */
+uint32_t ssd1681_page_size(uint8_t page);
+
+/**
+ * @brief Arena bytes in use
+ */
+uint32_t ssd1681_pages_used(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* pico_ssd1681_pages.h */
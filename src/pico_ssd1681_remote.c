@@ -0,0 +1,347 @@
+/**
+ * SSD1681 Remote Framebuffer Protocol
+ * Row-range deltas pushed from a host (USB-CDC or any byte stream), applied in place
+ *
+ * Copyright (c) 2026 OpenCode
+ * SPDX-License-Identifier: MIT
+ */
+
+#include "pico_ssd1681_remote.h"
+#include "pico/stdlib.h"
+
+#include <string.h>
+#include <stdio.h>
+
+#define PLANE_ROW_OFFSET(y) ((uint32_t)(SSD1681_PANEL_HEIGHT - 1 - (y)) * SSD1681_PLANE_STRIDE)
+
+/* Reply status codes */
+#define REMOTE_OK           0
+#define REMOTE_ERR_TYPE    -1
+#define REMOTE_ERR_ARGS    -2
+#define REMOTE_ERR_LENGTH  -3
+#define REMOTE_ERR_DATA    -4
+#define REMOTE_ERR_CRC     -5
+#define REMOTE_ERR_PLANE   -6
+
+/* Longest wait for a running refresh before a FAST_FULL flush gives up, as wait_busy() */
+#define REMOTE_BUSY_TIMEOUT_MS 10000
+
+typedef enum {
+    RX_SYNC = 0,
+    RX_TYPE,
+    RX_LEN_LO,
+    RX_LEN_HI,
+    RX_PAYLOAD,
+    RX_CRC_LO,
+    RX_CRC_HI,
+} remote_rx_state_t;
+
+/* Rows changed since the last flush, per plane */
+typedef struct {
+    bool dirty;
+    uint16_t top;
+    uint16_t bottom;
+} remote_dirty_t;
+
+static struct {
+    ssd1681_remote_reply_fn reply;
+    remote_rx_state_t state;
+    uint8_t type;
+    uint16_t len;
+    uint16_t pos;
+    uint16_t crc;
+    remote_dirty_t dirty[2];  /* Indexed by ssd1681_color_t */
+    uint8_t payload[SSD1681_REMOTE_MAX_PAYLOAD];
+} g_remote = {0};
+
+static uint16_t remote_crc16(uint16_t crc, uint8_t byte)
+{
+    crc ^= (uint16_t)byte << 8;
+    for (uint8_t i = 0; i < 8; i++) {
+        crc = (crc & 0x8000) ? (crc << 1) ^ 0x1021 : crc << 1;
+    }
+    return crc;
+}
+
+static void remote_reply_stdio(const uint8_t *data, uint16_t len)
+{
+    for (uint16_t i = 0; i < len; i++) {
+        putchar_raw(data[i]);
+    }
+    stdio_flush();
+}
+
+static void remote_send_reply(uint8_t type, int8_t status, const uint8_t *info, uint16_t info_len)
+{
+    uint8_t pkt[4 + 8 + 2];
+    uint16_t n = 0;
+    uint16_t payload_len = 1 + info_len;
+
+    pkt[n++] = SSD1681_REMOTE_SYNC;
+    pkt[n++] = type | 0x80;
+    pkt[n++] = payload_len & 0xFF;
+    pkt[n++] = payload_len >> 8;
+    pkt[n++] = (uint8_t)status;
+    memcpy(&pkt[n], info, info_len);
+    n += info_len;
+
+    uint16_t crc = 0xFFFF;
+    for (uint16_t i = 1; i < n; i++) {
+        crc = remote_crc16(crc, pkt[i]);
+    }
+    pkt[n++] = crc & 0xFF;
+    pkt[n++] = crc >> 8;
+
+    g_remote.reply(pkt, n);
+}
+
+/**
+ * @brief Decode run-length tokens over size bytes; with dst NULL only validate
+ */
+static int remote_decode(uint8_t *dst, uint32_t size, const uint8_t *src, uint32_t len, uint8_t encoding)
+{
+    uint32_t o = 0;
+    uint32_t i = 0;
+
+    while (i < len) {
+        uint8_t c = src[i++];
+        uint32_t n = (uint32_t)(c & 0x7F) + 1;
+        if (o + n > size) return REMOTE_ERR_DATA;
+
+        if (!(c & 0x80)) {
+            if (i + n > len) return REMOTE_ERR_DATA;
+            if (dst && encoding == SSD1681_REMOTE_XOR_RLE) {
+                for (uint32_t k = 0; k < n; k++) dst[o + k] ^= src[i + k];
+            } else if (dst) {
+                memcpy(dst + o, src + i, n);
+            }
+            i += n;
+        } else if (encoding == SSD1681_REMOTE_RLE) {
+            if (i >= len) return REMOTE_ERR_DATA;
+            if (dst) memset(dst + o, src[i], n);
+            i++;
+        }
+        /* XOR_RLE run: bytes unchanged */
+
+        o += n;
+    }
+
+    return (o == size) ? REMOTE_OK : REMOTE_ERR_DATA;
+}
+
+static int remote_rows(const uint8_t *p, uint16_t len)
+{
+    if (len < 6) return REMOTE_ERR_LENGTH;
+
+    const uint8_t color = p[0];
+    const uint8_t encoding = p[1];
+    const uint16_t top = p[2] | (p[3] << 8);
+    const uint16_t bottom = p[4] | (p[5] << 8);
+
+    if (color > SSD1681_COLOR_RED || encoding > SSD1681_REMOTE_RLE) return REMOTE_ERR_ARGS;
+    if (top > bottom || bottom >= SSD1681_PANEL_HEIGHT) return REMOTE_ERR_ARGS;
+
+    uint8_t *plane = ssd1681_get_framebuffer((ssd1681_color_t)color);
+    if (!plane) return REMOTE_ERR_PLANE;
+
+    /* Rows top..bottom are one contiguous byte range in the bottom-up plane */
+    uint8_t *dst = plane + PLANE_ROW_OFFSET(bottom);
+    const uint32_t size = (uint32_t)(bottom - top + 1) * SSD1681_PLANE_STRIDE;
+    const uint8_t *data = p + 6;
+    const uint16_t data_len = len - 6;
+
+    if (encoding == SSD1681_REMOTE_RAW) {
+        if (data_len != size) return REMOTE_ERR_DATA;
+        memcpy(dst, data, size);
+    } else {
+        /* Validate before touching the plane, a bad packet must not leave half a delta */
+        int ret = remote_decode(NULL, size, data, data_len, encoding);
+        if (ret != REMOTE_OK) return ret;
+        remote_decode(dst, size, data, data_len, encoding);
+    }
+
+    remote_dirty_t *d = &g_remote.dirty[color];
+    if (!d->dirty || top < d->top) d->top = top;
+    if (!d->dirty || bottom > d->bottom) d->bottom = bottom;
+    d->dirty = true;
+
+    return REMOTE_OK;
+}
+
+static int remote_flush(const uint8_t *p, uint16_t len)
+{
+    if (len != 1) return REMOTE_ERR_LENGTH;
+
+    /* Reject the update type before the dirty rows are consumed */
+    const uint8_t update_type = p[0];
+    if (update_type > SSD1681_UPDATE_CLEAN_FULL_AGGRESSIVE) return REMOTE_ERR_ARGS;
+    if (!ssd1681_get_framebuffer(SSD1681_COLOR_BLACK)) return REMOTE_ERR_PLANE;
+
+    const bool fast_full = (update_type == SSD1681_UPDATE_FAST_FULL);
+
+    for (uint8_t color = 0; color < 2; color++) {
+        remote_dirty_t *d = &g_remote.dirty[color];
+        if (!d->dirty) continue;
+
+        /* FAST_FULL re-sends the whole black plane itself */
+        if (!(fast_full && color == SSD1681_COLOR_BLACK)) {
+            int ret = ssd1681_write_buffer_region((ssd1681_color_t)color, 0, d->top,
+                                                 SSD1681_PANEL_WIDTH - 1, d->bottom);
+            if (ret != 0) return REMOTE_ERR_PLANE;
+        }
+        d->dirty = false;
+    }
+
+    if (!fast_full) {
+        return (ssd1681_update(update_type) == 0) ? REMOTE_OK : REMOTE_ERR_ARGS;
+    }
+
+    /* ssd1681_update() has no FAST_FULL sequence; wait out a running refresh, then flash */
+    for (uint32_t waited_ms = 0; waited_ms < REMOTE_BUSY_TIMEOUT_MS; waited_ms++) {
+        if (ssd1681_write_buffer_and_update_if_ready(update_type) == 0) return REMOTE_OK;
+        sleep_ms(1);
+    }
+    return REMOTE_ERR_PLANE;
+}
+
+static void remote_handle_packet(void)
+{
+    const uint8_t *p = g_remote.payload;
+    const uint16_t len = g_remote.len;
+
+    switch (g_remote.type) {
+        case SSD1681_REMOTE_HELLO: {
+            const uint8_t info[7] = {
+                SSD1681_PANEL_WIDTH & 0xFF, SSD1681_PANEL_WIDTH >> 8,
+                SSD1681_PANEL_HEIGHT & 0xFF, SSD1681_PANEL_HEIGHT >> 8,
+                ssd1681_get_framebuffer(SSD1681_COLOR_RED) ? 2 : 1,
+                SSD1681_REMOTE_MAX_PAYLOAD & 0xFF, SSD1681_REMOTE_MAX_PAYLOAD >> 8,
+            };
+            remote_send_reply(g_remote.type, REMOTE_OK, info, sizeof(info));
+            break;
+        }
+
+        case SSD1681_REMOTE_ROWS:
+            remote_send_reply(g_remote.type, remote_rows(p, len), NULL, 0);
+            break;
+
+        case SSD1681_REMOTE_FLUSH:
+            remote_send_reply(g_remote.type, remote_flush(p, len), NULL, 0);
+            break;
+
+        default:
+            remote_send_reply(g_remote.type, REMOTE_ERR_TYPE, NULL, 0);
+            break;
+    }
+}
+
+/**
+ * @brief Reset the decoder
+ */
+void ssd1681_remote_init(ssd1681_remote_reply_fn reply)
+{
+    memset(&g_remote, 0, sizeof(g_remote));
+    g_remote.reply = reply ? reply : remote_reply_stdio;
+}
+
+/**
+ * @brief Feed received bytes to the decoder
+ */
+int ssd1681_remote_feed(const uint8_t *data, uint32_t len)
+{
+    int handled = 0;
+
+    if (!g_remote.reply) ssd1681_remote_init(NULL);
+
+    for (uint32_t i = 0; i < len; i++) {
+        const uint8_t b = data[i];
+
+        switch (g_remote.state) {
+            case RX_SYNC:
+                if (b == SSD1681_REMOTE_SYNC) {
+                    g_remote.crc = 0xFFFF;
+                    g_remote.state = RX_TYPE;
+                }
+                break;
+
+            case RX_TYPE:
+                g_remote.type = b;
+                g_remote.crc = remote_crc16(g_remote.crc, b);
+                g_remote.state = RX_LEN_LO;
+                break;
+
+            case RX_LEN_LO:
+                g_remote.len = b;
+                g_remote.crc = remote_crc16(g_remote.crc, b);
+                g_remote.state = RX_LEN_HI;
+                break;
+
+            case RX_LEN_HI:
+                g_remote.len |= (uint16_t)b << 8;
+                g_remote.crc = remote_crc16(g_remote.crc, b);
+                g_remote.pos = 0;
+                if (g_remote.len > SSD1681_REMOTE_MAX_PAYLOAD) {
+                    remote_send_reply(g_remote.type, REMOTE_ERR_LENGTH, NULL, 0);
+                    g_remote.state = RX_SYNC;
+                } else {
+                    g_remote.state = g_remote.len ? RX_PAYLOAD : RX_CRC_LO;
+                }
+                break;
+
+            case RX_PAYLOAD: {
+                /* Copy as much of the payload as this chunk holds */
+                uint32_t n = g_remote.len - g_remote.pos;
+                if (n > len - i) n = len - i;
+                for (uint32_t k = 0; k < n; k++) {
+                    g_remote.crc = remote_crc16(g_remote.crc, data[i + k]);
+                }
+                memcpy(&g_remote.payload[g_remote.pos], &data[i], n);
+                g_remote.pos += n;
+                i += n - 1;
+                if (g_remote.pos == g_remote.len) g_remote.state = RX_CRC_LO;
+                break;
+            }
+
+            case RX_CRC_LO:
+                g_remote.crc ^= b;  /* Low byte must cancel to zero */
+                g_remote.state = RX_CRC_HI;
+                break;
+
+            case RX_CRC_HI:
+                g_remote.state = RX_SYNC;
+                if ((g_remote.crc ^ ((uint16_t)b << 8)) != 0) {
+                    remote_send_reply(g_remote.type, REMOTE_ERR_CRC, NULL, 0);
+                    break;
+                }
+                remote_handle_packet();
+                handled++;
+                break;
+        }
+    }
+
+    return handled;
+}
+
+/**
+ * @brief Read whatever stdin has buffered without blocking and feed it
+ */
+int ssd1681_remote_poll_stdio(void)
+{
+    uint8_t chunk[64];
+    uint32_t n = 0;
+    int handled = 0;
+
+    for (;;) {
+        int c = getchar_timeout_us(0);
+        if (c == PICO_ERROR_TIMEOUT || c < 0) break;
+
+        chunk[n++] = (uint8_t)c;
+        if (n == sizeof(chunk)) {
+            handled += ssd1681_remote_feed(chunk, n);
+            n = 0;
+        }
+    }
+    if (n) handled += ssd1681_remote_feed(chunk, n);
+
+    return handled;
+}
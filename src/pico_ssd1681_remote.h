@@ -0,0 +1,86 @@
+/**
+ * SSD1681 Remote Framebuffer Protocol
+ * Row-range deltas pushed from a host (USB-CDC or any byte stream), applied in place
+ *
+ * Copyright (c) 2026 OpenCode
+ * SPDX-License-Identifier: MIT
+ */
+
+#ifndef PICO_SSD1681_REMOTE_H
+#define PICO_SSD1681_REMOTE_H
+
+#include "pico_ssd1681.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief Largest packet payload accepted, the host splits updates to fit
+ */
+#ifndef SSD1681_REMOTE_MAX_PAYLOAD
+#define SSD1681_REMOTE_MAX_PAYLOAD 1024
+#endif
+
+/*
+ * Wire format (little-endian):
+ *   0xE5, type, len_lo, len_hi, payload[len], crc_lo, crc_hi
+ * crc is CRC-16/CCITT-FALSE over type, len and payload. Every packet gets a reply
+ * packet of type (type | 0x80) whose first payload byte is an int8 status (0 = ok).
+ *
+ * SSD1681_REMOTE_HELLO  no payload; reply: status, width (u16), height (u16), planes, max payload (u16)
+ * SSD1681_REMOTE_ROWS   color, encoding, top (u16), bottom (u16), data
+ *                       data covers rows top..bottom of the plane in native layout
+ *                       (bottom-up, so one contiguous byte range), encoded per ssd1681_remote_encoding_t
+ * SSD1681_REMOTE_FLUSH  update type; uploads the rows changed since the last flush and refreshes
+ *                       (FAST_FULL blocks until its first flash is done, like
+ *                       ssd1681_write_buffer_and_update_if_ready())
+ */
+#define SSD1681_REMOTE_SYNC  0xE5
+#define SSD1681_REMOTE_HELLO 0x01
+#define SSD1681_REMOTE_ROWS  0x02
+#define SSD1681_REMOTE_FLUSH 0x03
+
+/**
+ * @brief Row data encodings
+ * @note RLE and XOR_RLE use the run-length tokens of ssd1681_asset_encoding_t; in XOR_RLE a
+ *       token with bit 7 set leaves its bytes unchanged and nothing follows it.
+ */
+typedef enum {
+    SSD1681_REMOTE_RAW = 0,      /**< Plain bytes, replace the rows */
+    SSD1681_REMOTE_XOR_RLE = 1,  /**< Literals are XORed into the plane, runs skip unchanged bytes */
+    SSD1681_REMOTE_RLE = 2,      /**< Literals and repeats replace the rows */
+} ssd1681_remote_encoding_t;
+
+/**
+ * @brief Transport callback used to send reply packets
+ */
+typedef void (*ssd1681_remote_reply_fn)(const uint8_t *data, uint16_t len);
+
+/**
+ * @brief Reset the decoder
+ * @param reply Reply transport, NULL to reply on stdout (USB-CDC with pico_enable_stdio_usb)
+ */
+void ssd1681_remote_init(ssd1681_remote_reply_fn reply);
+
+/**
+ * @brief Feed received bytes to the decoder, from any transport
+ * @param data Bytes as received, packets may be split across calls
+ * @param len Number of bytes
+ * @return Number of packets handled
+ * @note Deltas are applied to the active planes (ssd1681_get_framebuffer()). Bytes outside a
+ *       packet are skipped, so the stream resynchronises after noise or stdio text.
+ */
+int ssd1681_remote_feed(const uint8_t *data, uint32_t len);
+
+/**
+ * @brief Read whatever stdin (USB-CDC) has buffered without blocking and feed it
+ * @return Number of packets handled
+ */
+int ssd1681_remote_poll_stdio(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* pico_ssd1681_remote.h */
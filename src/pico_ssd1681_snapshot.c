@@ -0,0 +1,181 @@
+/**
+ * SSD1681 Framebuffer Snapshots
+ * Persist what the panel shows in flash so a reboot can skip the clearing refresh
+ *
+ * Copyright (c) 2026 OpenCode
+ * SPDX-License-Identifier: MIT
+ */
+
+#include "pico_ssd1681_snapshot.h"
+#include "hardware/flash.h"
+#include "hardware/sync.h"
+#include "pico/stdlib.h"
+
+#include <string.h>
+
+#define SNAPSHOT_VERSION     1
+#define SNAPSHOT_ALIGN_UP(n, a) (((n) + (a) - 1) / (a) * (a))
+
+/* Header gets its own page, each plane starts on a page boundary */
+#define SNAPSHOT_PLANE_SPAN  SNAPSHOT_ALIGN_UP(SSD1681_PLANE_SIZE, FLASH_PAGE_SIZE)
+#define SNAPSHOT_PLANE_OFFSET(i) (FLASH_PAGE_SIZE + (i) * SNAPSHOT_PLANE_SPAN)
+
+_Static_assert(sizeof(ssd1681_snapshot_t) <= FLASH_PAGE_SIZE, "Snapshot header must fit one flash page");
+
+static uint32_t snapshot_hash(uint32_t hash, const uint8_t *data, uint32_t len)
+{
+    for (uint32_t i = 0; i < len; i++) {
+        hash = (hash ^ data[i]) * 16777619u;
+    }
+    return hash;
+}
+
+static const uint8_t *snapshot_plane(const ssd1681_snapshot_t *snap, uint16_t index)
+{
+    return (const uint8_t *)snap + SNAPSHOT_PLANE_OFFSET(index);
+}
+
+static uint16_t snapshot_live_planes(void)
+{
+    return ssd1681_get_framebuffer(SSD1681_COLOR_RED) ? 2 : 1;
+}
+
+/* Program one plane: whole pages straight from RAM, the tail through a padded page buffer */
+static void snapshot_program_plane(uint32_t offset, const uint8_t *plane)
+{
+    const uint32_t whole = SSD1681_PLANE_SIZE / FLASH_PAGE_SIZE * FLASH_PAGE_SIZE;
+    static uint8_t page[FLASH_PAGE_SIZE];
+
+    if (whole) {
+        flash_range_program(offset, plane, whole);
+    }
+    if (whole < SSD1681_PLANE_SIZE) {
+        memset(page, 0xFF, sizeof(page));
+        memcpy(page, plane + whole, SSD1681_PLANE_SIZE - whole);
+        flash_range_program(offset + whole, page, FLASH_PAGE_SIZE);
+    }
+}
+
+/**
+ * @brief Bytes of flash used by a snapshot
+ */
+uint32_t ssd1681_snapshot_flash_size(void)
+{
+    return SNAPSHOT_ALIGN_UP(SNAPSHOT_PLANE_OFFSET(2), FLASH_SECTOR_SIZE);
+}
+
+/**
+ * @brief Find a valid snapshot in flash
+ */
+const ssd1681_snapshot_t *ssd1681_snapshot_load_flash(uint32_t flash_offset)
+{
+    if (flash_offset % FLASH_SECTOR_SIZE) return NULL;
+
+    const ssd1681_snapshot_t *snap = (const ssd1681_snapshot_t *)(uintptr_t)(XIP_BASE + flash_offset);
+
+    if (snap->magic != SSD1681_SNAPSHOT_MAGIC || snap->version != SNAPSHOT_VERSION) return NULL;
+    if (snap->width != SSD1681_PANEL_WIDTH || snap->height != SSD1681_PANEL_HEIGHT) return NULL;
+    if (snap->planes < 1 || snap->planes > 2) return NULL;
+
+    uint32_t hash = 2166136261u;
+    for (uint16_t i = 0; i < snap->planes; i++) {
+        hash = snapshot_hash(hash, snapshot_plane(snap, i), SSD1681_PLANE_SIZE);
+    }
+    if (hash != snap->hash) return NULL;  /* Torn write */
+
+    return snap;
+}
+
+/**
+ * @brief Check whether the current planes are identical to a snapshot
+ */
+bool ssd1681_snapshot_matches(const ssd1681_snapshot_t *snap)
+{
+    if (!snap) return false;
+
+    const uint8_t *black = ssd1681_get_framebuffer(SSD1681_COLOR_BLACK);
+    const uint8_t *red = ssd1681_get_framebuffer(SSD1681_COLOR_RED);
+    if (!black) return false;
+
+    if (memcmp(black, snapshot_plane(snap, 0), SSD1681_PLANE_SIZE) != 0) return false;
+    if (!red) return true;
+
+    if (snap->planes > 1) {
+        return memcmp(red, snapshot_plane(snap, 1), SSD1681_PLANE_SIZE) == 0;
+    }
+
+    /* Snapshot without red: the panel shows no red, so the live plane must be all white */
+    for (uint32_t i = 0; i < SSD1681_PLANE_SIZE; i++) {
+        if (red[i] != 0xFF) return false;
+    }
+    return true;
+}
+
+/**
+ * @brief Save the current planes to flash
+ */
+int ssd1681_snapshot_save_flash(uint32_t flash_offset)
+{
+    if (flash_offset % FLASH_SECTOR_SIZE) return -2;
+
+    const uint8_t *planes[2] = {
+        ssd1681_get_framebuffer(SSD1681_COLOR_BLACK),
+        ssd1681_get_framebuffer(SSD1681_COLOR_RED),
+    };
+    if (!planes[0]) return -1;
+
+    const uint16_t count = snapshot_live_planes();
+
+    /* Avoid wearing flash when nothing changed */
+    const ssd1681_snapshot_t *old = ssd1681_snapshot_load_flash(flash_offset);
+    if (old && old->planes == count && ssd1681_snapshot_matches(old)) return 1;
+
+    static uint8_t header_page[FLASH_PAGE_SIZE];
+    ssd1681_snapshot_t *hdr = (ssd1681_snapshot_t *)header_page;
+
+    memset(header_page, 0xFF, sizeof(header_page));
+    hdr->magic = SSD1681_SNAPSHOT_MAGIC;
+    hdr->version = SNAPSHOT_VERSION;
+    hdr->planes = count;
+    hdr->width = SSD1681_PANEL_WIDTH;
+    hdr->height = SSD1681_PANEL_HEIGHT;
+    hdr->hash = 2166136261u;
+    for (uint16_t i = 0; i < count; i++) {
+        hdr->hash = snapshot_hash(hdr->hash, planes[i], SSD1681_PLANE_SIZE);
+    }
+
+    uint32_t irq = save_and_disable_interrupts();
+    flash_range_erase(flash_offset, ssd1681_snapshot_flash_size());
+    for (uint16_t i = 0; i < count; i++) {
+        snapshot_program_plane(flash_offset + SNAPSHOT_PLANE_OFFSET(i), planes[i]);
+    }
+    /* Header last: a reset mid-write leaves no valid magic */
+    flash_range_program(flash_offset, header_page, FLASH_PAGE_SIZE);
+    restore_interrupts(irq);
+
+    return 0;
+}
+
+/**
+ * @brief Warm-start init
+ */
+int ssd1681_init_warm(const ssd1681_config_t *config, const ssd1681_snapshot_t *snap)
+{
+    int ret = ssd1681_init(config);
+    if (ret != 0 || !snap) return ret;
+
+    uint8_t *black = ssd1681_get_framebuffer(SSD1681_COLOR_BLACK);
+    uint8_t *red = ssd1681_get_framebuffer(SSD1681_COLOR_RED);
+
+    /* Restore the planes and bring controller RAM in line with the glass, no refresh */
+    if (black) {
+        memcpy(black, snapshot_plane(snap, 0), SSD1681_PLANE_SIZE);
+        ssd1681_write_buffer(SSD1681_COLOR_BLACK);
+    }
+    if (red && snap->planes > 1) {
+        memcpy(red, snapshot_plane(snap, 1), SSD1681_PLANE_SIZE);
+        ssd1681_write_buffer(SSD1681_COLOR_RED);
+    }
+
+    return 0;
+}
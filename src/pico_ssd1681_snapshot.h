@@ -0,0 +1,77 @@
+/**
+ * SSD1681 Framebuffer Snapshots
+ * Persist what the panel shows in flash so a reboot can skip the clearing refresh
+ *
+ * Copyright (c) 2026 OpenCode
+ * SPDX-License-Identifier: MIT
+ */
+
+#ifndef PICO_SSD1681_SNAPSHOT_H
+#define PICO_SSD1681_SNAPSHOT_H
+
+#include "pico_ssd1681.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief Snapshot header, stored at the start of the flash area
+ * @note The planes follow at 256-byte aligned offsets, see ssd1681_snapshot_flash_size()
+ */
+typedef struct {
+    uint32_t magic;       /**< SSD1681_SNAPSHOT_MAGIC */
+    uint16_t version;
+    uint16_t planes;      /**< 1 (black) or 2 (black + red) */
+    uint16_t width;       /**< Must match SSD1681_PANEL_WIDTH */
+    uint16_t height;      /**< Must match SSD1681_PANEL_HEIGHT */
+    uint32_t hash;        /**< FNV-1a over all stored plane bytes */
+} ssd1681_snapshot_t;
+
+#define SSD1681_SNAPSHOT_MAGIC 0x31383653u  /* "S681" */
+
+/**
+ * @brief Bytes of flash used by a snapshot, a whole number of flash sectors
+ */
+uint32_t ssd1681_snapshot_flash_size(void);
+
+/**
+ * @brief Find a valid snapshot in flash
+ * @param flash_offset Offset from the start of flash, sector aligned
+ * @return Snapshot (read in place through XIP), NULL if missing, torn or for other geometry
+ */
+const ssd1681_snapshot_t *ssd1681_snapshot_load_flash(uint32_t flash_offset);
+
+/**
+ * @brief Save the current planes to flash, call after a refresh has been started
+ * @param flash_offset Offset from the start of flash, sector aligned, outside the program image
+ * @return 0 if written, 1 if the stored snapshot already matched, negative on error
+ * @note Interrupts are disabled while flash is written; the other core must not run from flash.
+ */
+int ssd1681_snapshot_save_flash(uint32_t flash_offset);
+
+/**
+ * @brief Check whether the current planes are identical to a snapshot
+ * @param snap Snapshot from ssd1681_snapshot_load_flash(), NULL never matches
+ * @return true if the panel already shows what is in the framebuffer
+ * @note A live red plane is compared against all white when the snapshot has no red plane.
+ */
+bool ssd1681_snapshot_matches(const ssd1681_snapshot_t *snap);
+
+/**
+ * @brief Warm-start init: initialize the controller and restore the snapshot instead of clearing
+ * @param config Pin configuration
+ * @param snap Snapshot of what the panel physically shows, NULL falls back to a plain ssd1681_init()
+ * @return 0 on success, same errors as ssd1681_init()
+ * @note The planes are restored and written to controller RAM without a refresh, so partial
+ *       updates keep working. The app then draws what it wants and only refreshes if
+ *       ssd1681_snapshot_matches() is false. The hardware reset is kept: controller registers
+ *       do not survive deep sleep and cannot be read back.
+ */
+int ssd1681_init_warm(const ssd1681_config_t *config, const ssd1681_snapshot_t *snap);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* pico_ssd1681_snapshot.h */
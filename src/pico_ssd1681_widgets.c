@@ -0,0 +1,330 @@
+/**
+ * SSD1681 Retained-Mode Widget Layer
+ * Fixed-capacity scene on top of the immediate-mode drawing API
+ *
+ * Copyright (c) 2026 OpenCode
+ * SPDX-License-Identifier: MIT
+ */
+
+#include "pico_ssd1681_widgets.h"
+
+#include <string.h>
+
+typedef struct {
+    bool used;
+    bool visible;
+    bool dirty;    /* Property changed since the last render */
+    bool redraw;   /* Scratch: selected for repaint in the current render */
+    uint8_t type;
+    uint8_t color;
+    uint8_t font;
+    uint8_t value;
+    ssd1681_rect_t bounds;
+    const uint8_t *img;
+    char text[SSD1681_WIDGET_TEXT_MAX];
+} ssd1681_widget_t;
+
+/* Scene state */
+static struct {
+    ssd1681_widget_t widgets[SSD1681_WIDGET_MAX];
+    ssd1681_rect_t damage[SSD1681_WIDGET_MAX + 1];
+    bool clear_all;  /* Set by reset: repaint the whole screen once */
+    bool red_touched;  /* Last render changed red widgets */
+} g_scene = { .clear_all = true };
+
+static bool rect_overlaps(const ssd1681_rect_t *a, const ssd1681_rect_t *b)
+{
+    return a->left <= b->right && b->left <= a->right &&
+           a->top <= b->bottom && b->top <= a->bottom;
+}
+
+static void rect_union(ssd1681_rect_t *acc, const ssd1681_rect_t *r)
+{
+    if (r->left < acc->left) acc->left = r->left;
+    if (r->top < acc->top) acc->top = r->top;
+    if (r->right > acc->right) acc->right = r->right;
+    if (r->bottom > acc->bottom) acc->bottom = r->bottom;
+}
+
+static ssd1681_widget_t *scene_get(int id)
+{
+    if (id < 0 || id >= SSD1681_WIDGET_MAX) return NULL;
+    if (!g_scene.widgets[id].used) return NULL;
+    return &g_scene.widgets[id];
+}
+
+static int scene_add(uint8_t type, ssd1681_color_t color, const ssd1681_rect_t *bounds)
+{
+    if (!bounds) return -2;
+    if (bounds->left > bounds->right || bounds->top > bounds->bottom) return -3;
+    if (bounds->right >= SSD1681_PANEL_WIDTH || bounds->bottom >= SSD1681_PANEL_HEIGHT) return -3;
+
+    for (int id = 0; id < SSD1681_WIDGET_MAX; id++) {
+        ssd1681_widget_t *w = &g_scene.widgets[id];
+        if (w->used) continue;
+
+        memset(w, 0, sizeof(*w));
+        w->used = true;
+        w->visible = true;
+        w->dirty = true;
+        w->type = type;
+        w->color = color;
+        w->bounds = *bounds;
+        return id;
+    }
+
+    return -1;  /* Pool full */
+}
+
+static void scene_draw_widget(const ssd1681_widget_t *w)
+{
+    const ssd1681_rect_t *b = &w->bounds;
+
+    switch (w->type) {
+        case SSD1681_WIDGET_RECT:
+            ssd1681_fill_rect(w->color, b->left, b->top, b->right, b->bottom, 1);
+            break;
+
+        case SSD1681_WIDGET_LABEL:
+            /* Clipped to the bounds: the damage pass only repaints inside them */
+            ssd1681_draw_text(w->color, b, w->text, strlen(w->text), 1, w->font, SSD1681_ALIGN_LEFT, true);
+            break;
+
+        case SSD1681_WIDGET_ICON:
+            if (w->img) {
+                ssd1681_draw_picture(w->color, b->left, b->top, b->right, b->bottom, w->img);
+            }
+            break;
+
+        case SSD1681_WIDGET_BAR: {
+            /* 1px outline, 1px gap, then the fill */
+            ssd1681_fill_rect(w->color, b->left, b->top, b->right, b->top, 1);
+            ssd1681_fill_rect(w->color, b->left, b->bottom, b->right, b->bottom, 1);
+            ssd1681_fill_rect(w->color, b->left, b->top, b->left, b->bottom, 1);
+            ssd1681_fill_rect(w->color, b->right, b->top, b->right, b->bottom, 1);
+
+            if (b->right - b->left < 4 || b->bottom - b->top < 4) break;
+            uint16_t inner = b->right - b->left - 3;
+            uint16_t filled = (uint32_t)inner * w->value / 100;
+            if (filled > 0) {
+                ssd1681_fill_rect(w->color, b->left + 2, b->top + 2,
+                                  b->left + 1 + filled, b->bottom - 2, 1);
+            }
+            break;
+        }
+
+        default:
+            break;
+    }
+}
+
+/**
+ * @brief Remove all widgets
+ */
+void ssd1681_scene_reset(void)
+{
+    memset(&g_scene, 0, sizeof(g_scene));
+    g_scene.clear_all = true;
+}
+
+/**
+ * @brief Add a filled rectangle
+ */
+int ssd1681_scene_add_rect(ssd1681_color_t color, const ssd1681_rect_t *bounds)
+{
+    return scene_add(SSD1681_WIDGET_RECT, color, bounds);
+}
+
+/**
+ * @brief Add a text label
+ */
+int ssd1681_scene_add_label(ssd1681_color_t color, const ssd1681_rect_t *bounds,
+                            uint8_t font, const char *text)
+{
+    int id = scene_add(SSD1681_WIDGET_LABEL, color, bounds);
+    if (id < 0) return id;
+
+    g_scene.widgets[id].font = font;
+    if (text) {
+        strncpy(g_scene.widgets[id].text, text, SSD1681_WIDGET_TEXT_MAX - 1);
+    }
+    return id;
+}
+
+/**
+ * @brief Add an icon
+ */
+int ssd1681_scene_add_icon(ssd1681_color_t color, const ssd1681_rect_t *bounds, const uint8_t *img)
+{
+    int id = scene_add(SSD1681_WIDGET_ICON, color, bounds);
+    if (id < 0) return id;
+
+    g_scene.widgets[id].img = img;
+    return id;
+}
+
+/**
+ * @brief Add a progress bar
+ */
+int ssd1681_scene_add_bar(ssd1681_color_t color, const ssd1681_rect_t *bounds, uint8_t value)
+{
+    int id = scene_add(SSD1681_WIDGET_BAR, color, bounds);
+    if (id < 0) return id;
+
+    g_scene.widgets[id].value = (value > 100) ? 100 : value;
+    return id;
+}
+
+/**
+ * @brief Change a label's text
+ */
+int ssd1681_scene_set_text(int id, const char *text)
+{
+    ssd1681_widget_t *w = scene_get(id);
+    if (!w || w->type != SSD1681_WIDGET_LABEL) return -1;
+    if (!text) return -2;
+
+    if (strncmp(w->text, text, SSD1681_WIDGET_TEXT_MAX - 1) != 0) {
+        strncpy(w->text, text, SSD1681_WIDGET_TEXT_MAX - 1);
+        w->dirty = true;
+    }
+    return 0;
+}
+
+/**
+ * @brief Change a bar's value
+ */
+int ssd1681_scene_set_value(int id, uint8_t value)
+{
+    ssd1681_widget_t *w = scene_get(id);
+    if (!w || w->type != SSD1681_WIDGET_BAR) return -1;
+
+    if (value > 100) value = 100;
+    if (w->value != value) {
+        w->value = value;
+        w->dirty = true;
+    }
+    return 0;
+}
+
+/**
+ * @brief Change an icon's image
+ */
+int ssd1681_scene_set_icon(int id, const uint8_t *img)
+{
+    ssd1681_widget_t *w = scene_get(id);
+    if (!w || w->type != SSD1681_WIDGET_ICON) return -1;
+
+    if (w->img != img) {
+        w->img = img;
+        w->dirty = true;
+    }
+    return 0;
+}
+
+/**
+ * @brief Show or hide a widget
+ */
+int ssd1681_scene_set_visible(int id, bool visible)
+{
+    ssd1681_widget_t *w = scene_get(id);
+    if (!w) return -1;
+
+    if (w->visible != visible) {
+        w->visible = visible;
+        w->dirty = true;
+    }
+    return 0;
+}
+
+/**
+ * @brief Re-render changed widgets
+ */
+int ssd1681_scene_render(ssd1681_rect_t *damage)
+{
+    uint16_t n_damage = 0;
+    bool red_touched = g_scene.clear_all;
+
+    if (g_scene.clear_all) {
+        g_scene.damage[n_damage++] = (ssd1681_rect_t){0, 0, SSD1681_PANEL_WIDTH - 1, SSD1681_PANEL_HEIGHT - 1};
+    }
+
+    /* Seed the damage list with every changed widget (hidden ones leave a hole to repaint) */
+    for (int id = 0; id < SSD1681_WIDGET_MAX; id++) {
+        ssd1681_widget_t *w = &g_scene.widgets[id];
+        w->redraw = false;
+        if (!w->used || !w->dirty) continue;
+
+        w->redraw = w->visible;
+        red_touched |= (w->color == SSD1681_COLOR_RED);
+        g_scene.damage[n_damage++] = w->bounds;
+    }
+
+    if (n_damage == 0) return 1;
+
+    /*
+     * Anything overlapping damage gets repainted, and its own bounds become damage
+     * (repainting it may cover pixels of widgets above it). Iterate to a fixed point.
+     */
+    bool grew = true;
+    while (grew) {
+        grew = false;
+        for (int id = 0; id < SSD1681_WIDGET_MAX; id++) {
+            ssd1681_widget_t *w = &g_scene.widgets[id];
+            if (!w->used || !w->visible || w->redraw) continue;
+
+            for (uint16_t d = 0; d < n_damage; d++) {
+                if (!rect_overlaps(&w->bounds, &g_scene.damage[d])) continue;
+
+                w->redraw = true;
+                red_touched |= (w->color == SSD1681_COLOR_RED);
+                g_scene.damage[n_damage++] = w->bounds;  /* At most once per widget, plus clear_all */
+                grew = true;
+                break;
+            }
+        }
+    }
+
+    /* Clear damaged areas on both planes, then repaint in creation (z) order */
+    ssd1681_rect_t box = g_scene.damage[0];
+    for (uint16_t d = 0; d < n_damage; d++) {
+        const ssd1681_rect_t *r = &g_scene.damage[d];
+        ssd1681_fill_rect(SSD1681_COLOR_BLACK, r->left, r->top, r->right, r->bottom, 0);
+        ssd1681_fill_rect(SSD1681_COLOR_RED, r->left, r->top, r->right, r->bottom, 0);
+        rect_union(&box, r);
+    }
+
+    for (int id = 0; id < SSD1681_WIDGET_MAX; id++) {
+        ssd1681_widget_t *w = &g_scene.widgets[id];
+        if (w->redraw) {
+            scene_draw_widget(w);
+        }
+        w->dirty = false;
+    }
+
+    g_scene.clear_all = false;
+    g_scene.red_touched = red_touched;
+    if (damage) *damage = box;
+
+    return 0;
+}
+
+/**
+ * @brief Render and send only the damaged region
+ */
+int ssd1681_scene_flush(uint8_t update_type)
+{
+    ssd1681_rect_t box;
+    int ret = ssd1681_scene_render(&box);
+    if (ret != 0) return ret;
+
+    ret = ssd1681_write_buffer_region(SSD1681_COLOR_BLACK, box.left, box.top, box.right, box.bottom);
+    if (ret != 0) return ret;
+
+    /* Like the update paths, leave red RAM alone unless red content actually changed */
+    if (g_scene.red_touched) {
+        ssd1681_write_buffer_region(SSD1681_COLOR_RED, box.left, box.top, box.right, box.bottom);
+    }
+
+    return ssd1681_update(update_type);
+}
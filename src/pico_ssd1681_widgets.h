@@ -0,0 +1,128 @@
+/**
+ * SSD1681 Retained-Mode Widget Layer
+ * Fixed-capacity scene on top of the immediate-mode drawing API
+ *
+ * Copyright (c) 2026 OpenCode
+ * SPDX-License-Identifier: MIT
+ */
+
+#ifndef PICO_SSD1681_WIDGETS_H
+#define PICO_SSD1681_WIDGETS_H
+
+#include "pico_ssd1681.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief Scene capacity, fixed at compile time (no heap use)
+ */
+#ifndef SSD1681_WIDGET_MAX
+#define SSD1681_WIDGET_MAX      32
+#endif
+
+/**
+ * @brief Maximum label length including the terminator
+ */
+#ifndef SSD1681_WIDGET_TEXT_MAX
+#define SSD1681_WIDGET_TEXT_MAX 24
+#endif
+
+/**
+ * @brief Widget kinds
+ */
+typedef enum {
+    SSD1681_WIDGET_RECT = 0,   /**< Filled rectangle */
+    SSD1681_WIDGET_LABEL = 1,  /**< Text drawn with ssd1681_draw_text(), wrapped and clipped to the bounds */
+    SSD1681_WIDGET_ICON = 2,   /**< 1bpp image drawn with ssd1681_draw_picture() */
+    SSD1681_WIDGET_BAR = 3,    /**< Outlined bar filled to a 0-100 value */
+} ssd1681_widget_type_t;
+
+/**
+ * @brief Remove all widgets
+ * @note The scene owns the whole screen: the next render repaints everything on a white background
+ */
+void ssd1681_scene_reset(void);
+
+/**
+ * @brief Add a filled rectangle
+ * @param color Color plane
+ * @param bounds Widget bounds
+ * @return Widget id (>= 0), negative on error
+ */
+int ssd1681_scene_add_rect(ssd1681_color_t color, const ssd1681_rect_t *bounds);
+
+/**
+ * @brief Add a text label
+ * @param color Color plane
+ * @param bounds Widget bounds (area repainted when the text changes)
+ * @param font Font size
+ * @param text Initial text, copied into the widget
+ * @return Widget id (>= 0), negative on error
+ */
+int ssd1681_scene_add_label(ssd1681_color_t color, const ssd1681_rect_t *bounds,
+                            uint8_t font, const char *text);
+
+/**
+ * @brief Add an icon
+ * @param color Color plane
+ * @param bounds Widget bounds, the image covers them exactly
+ * @param img Image buffer (1 bit per pixel, row-major), must stay valid
+ * @return Widget id (>= 0), negative on error
+ */
+int ssd1681_scene_add_icon(ssd1681_color_t color, const ssd1681_rect_t *bounds, const uint8_t *img);
+
+/**
+ * @brief Add a progress bar
+ * @param color Color plane
+ * @param bounds Widget bounds (outline)
+ * @param value Fill level 0-100
+ * @return Widget id (>= 0), negative on error
+ */
+int ssd1681_scene_add_bar(ssd1681_color_t color, const ssd1681_rect_t *bounds, uint8_t value);
+
+/**
+ * @brief Change a label's text
+ * @return 0 on success, widget is only marked dirty if the text differs
+ */
+int ssd1681_scene_set_text(int id, const char *text);
+
+/**
+ * @brief Change a bar's value (0-100)
+ * @return 0 on success, widget is only marked dirty if the value differs
+ */
+int ssd1681_scene_set_value(int id, uint8_t value);
+
+/**
+ * @brief Change an icon's image
+ * @return 0 on success
+ */
+int ssd1681_scene_set_icon(int id, const uint8_t *img);
+
+/**
+ * @brief Show or hide a widget
+ * @return 0 on success
+ */
+int ssd1681_scene_set_visible(int id, bool visible);
+
+/**
+ * @brief Re-render changed widgets into the framebuffer
+ * @param damage Output: bounding box of all repainted pixels (may be NULL)
+ * @return 0 if something was repainted, 1 if the scene was clean, negative on error
+ * @note Widgets overlapping a changed widget are repainted too, in creation order
+ */
+int ssd1681_scene_render(ssd1681_rect_t *damage);
+
+/**
+ * @brief Render, send only the damaged region to display RAM, then refresh
+ * @param update_type Update type passed to ssd1681_update()
+ * @return 0 on refresh, 1 if nothing changed, negative on error
+ */
+int ssd1681_scene_flush(uint8_t update_type);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* pico_ssd1681_widgets.h */
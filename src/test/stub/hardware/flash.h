@@ -0,0 +1,21 @@
+/**
+ * Host stand-in for the Pico SDK: flash programming into a RAM array
+ *
+ * Copyright (c) 2026 OpenCode
+ * SPDX-License-Identifier: MIT
+ */
+
+#ifndef STUB_HARDWARE_FLASH_H
+#define STUB_HARDWARE_FLASH_H
+
+#include <stdint.h>
+#include <stddef.h>
+
+#define FLASH_PAGE_SIZE   256u
+#define FLASH_SECTOR_SIZE 4096u
+#define XIP_BASE          0x10000000u
+
+void flash_range_erase(uint32_t offset, size_t count);
+void flash_range_program(uint32_t offset, const uint8_t *data, size_t count);
+
+#endif
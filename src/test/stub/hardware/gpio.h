@@ -0,0 +1,26 @@
+/**
+ * Host stand-in for the Pico SDK: GPIO, BUSY always low
+ *
+ * Copyright (c) 2026 OpenCode
+ * SPDX-License-Identifier: MIT
+ */
+
+#ifndef STUB_HARDWARE_GPIO_H
+#define STUB_HARDWARE_GPIO_H
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#define GPIO_OUT 1
+#define GPIO_IN 0
+#define GPIO_FUNC_SPI 1
+
+static inline void gpio_put(uint32_t pin, bool value) { (void)pin; (void)value; }
+static inline bool gpio_get(uint32_t pin) { (void)pin; return false; }
+static inline void gpio_init(uint32_t pin) { (void)pin; }
+static inline void gpio_deinit(uint32_t pin) { (void)pin; }
+static inline void gpio_set_dir(uint32_t pin, bool out) { (void)pin; (void)out; }
+static inline void gpio_pull_down(uint32_t pin) { (void)pin; }
+static inline void gpio_set_function(uint32_t pin, int fn) { (void)pin; (void)fn; }
+
+#endif
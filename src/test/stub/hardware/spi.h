@@ -0,0 +1,53 @@
+/**
+ * Host stand-in for the Pico SDK: SPI, writes are discarded
+ *
+ * Copyright (c) 2026 OpenCode
+ * SPDX-License-Identifier: MIT
+ */
+
+#ifndef STUB_HARDWARE_SPI_H
+#define STUB_HARDWARE_SPI_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+
+typedef struct {
+    volatile uint32_t cr0, cr1, dr, sr, cpsr, imsc, ris, mis, icr, dmacr;
+} spi_hw_t;
+
+typedef struct spi_inst spi_inst_t;
+
+extern spi_hw_t stub_spi_hw[2];
+#define spi0 ((spi_inst_t *)&stub_spi_hw[0])
+#define spi1 ((spi_inst_t *)&stub_spi_hw[1])
+
+#define SPI_SSPCR1_SSE_BITS   0x2u
+#define SPI_SSPCR0_DSS_LSB    0
+#define SPI_SSPCR0_FRF_LSB    4
+#define SPI_SSPCR0_SPO_LSB    6
+#define SPI_SSPCR0_SPH_LSB    7
+#define SPI_SSPICR_RORIC_BITS 0x1u
+
+typedef enum { SPI_CPOL_0, SPI_CPOL_1 } spi_cpol_t;
+typedef enum { SPI_CPHA_0, SPI_CPHA_1 } spi_cpha_t;
+typedef enum { SPI_LSB_FIRST, SPI_MSB_FIRST } spi_order_t;
+
+static inline spi_hw_t *spi_get_hw(spi_inst_t *spi) { return (spi_hw_t *)spi; }
+static inline bool spi_is_writable(const spi_inst_t *spi) { (void)spi; return true; }
+static inline bool spi_is_readable(const spi_inst_t *spi) { (void)spi; return false; }
+static inline bool spi_is_busy(const spi_inst_t *spi) { (void)spi; return false; }
+static inline uint32_t spi_init(spi_inst_t *spi, uint32_t baud) { (void)spi; return baud; }
+static inline void spi_deinit(spi_inst_t *spi) { (void)spi; }
+static inline uint32_t spi_get_baudrate(const spi_inst_t *spi) { (void)spi; return 0; }
+static inline uint32_t spi_set_baudrate(spi_inst_t *spi, uint32_t baud) { (void)spi; return baud; }
+static inline void spi_set_format(spi_inst_t *spi, uint32_t bits, spi_cpol_t cpol, spi_cpha_t cpha, spi_order_t order)
+{
+    (void)spi; (void)bits; (void)cpol; (void)cpha; (void)order;
+}
+static inline void hw_set_bits(volatile uint32_t *addr, uint32_t mask) { *addr |= mask; }
+static inline void hw_clear_bits(volatile uint32_t *addr, uint32_t mask) { *addr &= ~mask; }
+
+int spi_write_blocking(spi_inst_t *spi, const uint8_t *src, size_t len);
+
+#endif
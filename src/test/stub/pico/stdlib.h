@@ -0,0 +1,34 @@
+/**
+ * Host stand-in for the Pico SDK: time and stdio
+ *
+ * Copyright (c) 2026 OpenCode
+ * SPDX-License-Identifier: MIT
+ */
+
+#ifndef STUB_PICO_STDLIB_H
+#define STUB_PICO_STDLIB_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdio.h>
+
+#include "hardware/gpio.h"
+
+#define PICO_ERROR_TIMEOUT (-1)
+
+typedef uint64_t absolute_time_t;
+
+static inline void sleep_ms(uint32_t ms) { (void)ms; }
+static inline void sleep_us(uint64_t us) { (void)us; }
+static inline void tight_loop_contents(void) {}
+static inline uint64_t time_us_64(void) { return 0; }
+static inline uint32_t time_us_32(void) { return 0; }
+static inline absolute_time_t get_absolute_time(void) { return 0; }
+static inline uint64_t to_us_since_boot(absolute_time_t t) { return t; }
+static inline void stdio_init_all(void) {}
+static inline int putchar_raw(int c) { return putchar(c); }
+static inline void stdio_flush(void) { fflush(stdout); }
+static inline int getchar_timeout_us(uint32_t us) { (void)us; return PICO_ERROR_TIMEOUT; }
+
+#endif
@@ -0,0 +1,8 @@
+/**
+ * Host stand-in for the Pico SDK
+ *
+ * Copyright (c) 2026 OpenCode
+ * SPDX-License-Identifier: MIT
+ */
+
+#include "pico/stdlib.h"
@@ -0,0 +1,34 @@
+/**
+ * Host stand-in for the Pico SDK: out-of-line parts
+ *
+ * Copyright (c) 2026 OpenCode
+ * SPDX-License-Identifier: MIT
+ */
+
+#include "hardware/spi.h"
+#include "hardware/flash.h"
+
+#include <string.h>
+
+spi_hw_t stub_spi_hw[2];
+
+static uint8_t stub_flash[64 * 1024];
+
+int spi_write_blocking(spi_inst_t *spi, const uint8_t *src, size_t len)
+{
+    (void)spi;
+    (void)src;
+    return (int)len;
+}
+
+void flash_range_erase(uint32_t offset, size_t count)
+{
+    memset(stub_flash + offset, 0xFF, count);
+}
+
+void flash_range_program(uint32_t offset, const uint8_t *data, size_t count)
+{
+    for (size_t i = 0; i < count; i++) {
+        stub_flash[offset + i] &= data[i];
+    }
+}
@@ -0,0 +1,88 @@
+/**
+ * Host test: layer raster ops agree with the pattern brushes
+ *
+ * Copyright (c) 2026 OpenCode
+ * SPDX-License-Identifier: MIT
+ */
+
+#include "pico_ssd1681_layers.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define W SSD1681_PANEL_WIDTH
+#define H SSD1681_PANEL_HEIGHT
+
+static uint8_t base[SSD1681_PLANE_SIZE] __attribute__((aligned(4)));
+static uint8_t source[SSD1681_PLANE_SIZE] __attribute__((aligned(4)));
+static uint8_t expected[SSD1681_PLANE_SIZE];
+
+static const uint8_t pattern_clear[8] = {0};
+
+/* Tile an 8x8 pattern over a layer, in native polarity (0 = ink) */
+static void tile_pattern(uint8_t *plane, const uint8_t pattern[8])
+{
+    for (int y = 0; y < H; y++) {
+        memset(plane + (H - 1 - y) * SSD1681_PLANE_STRIDE, (uint8_t)~pattern[y % 8], SSD1681_PLANE_STRIDE);
+    }
+}
+
+/* Composite base (COPY) and source with rop, return the plane */
+static const uint8_t *composite(ssd1681_rop_t rop)
+{
+    ssd1681_layer_attach(0, SSD1681_COLOR_BLACK, base, NULL, SSD1681_ROP_COPY, 0, H - 1);
+    ssd1681_layer_attach(1, SSD1681_COLOR_BLACK, source, NULL, rop, 0, H - 1);
+    ssd1681_layers_composite(NULL, NULL);
+    return ssd1681_get_framebuffer(SSD1681_COLOR_BLACK);
+}
+
+/* Same result through ssd1681_fill_pattern() on a copy of base */
+static int check_rop(const char *name, ssd1681_rop_t rop, const uint8_t pattern[8])
+{
+    uint8_t *plane = ssd1681_get_framebuffer(SSD1681_COLOR_BLACK);
+
+    memcpy(plane, base, SSD1681_PLANE_SIZE);
+    ssd1681_fill_pattern(SSD1681_COLOR_BLACK, 0, 0, W - 1, H - 1, pattern, rop);
+    memcpy(expected, plane, SSD1681_PLANE_SIZE);
+
+    tile_pattern(source, pattern);
+    int bad = memcmp(composite(rop), expected, SSD1681_PLANE_SIZE) != 0;
+    printf("%s: %s\n", name, bad ? "MISMATCH" : "ok");
+    return bad;
+}
+
+int main(void)
+{
+    ssd1681_config_t config;
+    ssd1681_get_default_config_4wire(&config);
+    if (ssd1681_init(&config) != 0) return 1;
+
+    srand(1);
+    for (int i = 0; i < SSD1681_PLANE_SIZE; i++) base[i] = (uint8_t)rand();
+
+    int fail = 0;
+    fail |= check_rop("copy", SSD1681_ROP_COPY, ssd1681_pattern_checker);
+    fail |= check_rop("or", SSD1681_ROP_OR, ssd1681_pattern_diagonal);
+    fail |= check_rop("and", SSD1681_ROP_AND, ssd1681_pattern_checker);
+    fail |= check_rop("and clear", SSD1681_ROP_AND, pattern_clear);
+    fail |= check_rop("xor", SSD1681_ROP_XOR, ssd1681_pattern_gray25);
+
+    /* AND keeps base ink only where the layer has ink: all-ink base, layer ink at x < 100 */
+    memset(base, 0x00, SSD1681_PLANE_SIZE);
+    memset(source, 0xFF, SSD1681_PLANE_SIZE);
+    for (int y = 0; y < H; y++) {
+        memset(source + (H - 1 - y) * SSD1681_PLANE_STRIDE, 0x00, 100 / 8);
+        source[(H - 1 - y) * SSD1681_PLANE_STRIDE + 100 / 8] = 0x0F;
+    }
+    composite(SSD1681_ROP_AND);
+
+    uint8_t inside = 0;
+    uint8_t outside = 1;
+    ssd1681_read_point(SSD1681_COLOR_BLACK, 10, 5, &inside);
+    ssd1681_read_point(SSD1681_COLOR_BLACK, 150, 5, &outside);
+    printf("and mask: inside %u outside %u\n", inside, outside);
+    fail |= inside != 1 || outside != 0;
+
+    return fail ? 1 : 0;
+}
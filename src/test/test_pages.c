@@ -0,0 +1,86 @@
+/**
+ * Host test: page cache round trip and the shared run-length decoder
+ *
+ * Copyright (c) 2026 OpenCode
+ * SPDX-License-Identifier: MIT
+ */
+
+#include "pico_ssd1681_pages.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define W SSD1681_PANEL_WIDTH
+#define H SSD1681_PANEL_HEIGHT
+
+static uint8_t arena[4 * SSD1681_PLANE_SIZE];
+static uint8_t frame[SSD1681_PLANE_SIZE];
+static uint8_t expected[SSD1681_PLANE_SIZE];
+
+static int check(const char *name, int bad)
+{
+    printf("%s: %s\n", name, bad ? "FAIL" : "ok");
+    return bad;
+}
+
+/* White with runs, literals and noise, so every token kind is used */
+static void make_frame(uint8_t *plane)
+{
+    memset(plane, 0xFF, SSD1681_PLANE_SIZE);
+    for (int i = 0; i < SSD1681_PLANE_SIZE; i += 97) {
+        int n = rand() % 300;
+        for (int k = 0; k < n && i + k < SSD1681_PLANE_SIZE; k++) {
+            plane[i + k] = (k % 5 < 2) ? 0x00 : (uint8_t)rand();
+        }
+    }
+}
+
+int main(void)
+{
+    ssd1681_config_t config;
+    ssd1681_get_default_config_4wire(&config);
+    if (ssd1681_init(&config) != 0) return 1;
+
+    uint8_t *black = ssd1681_get_framebuffer(SSD1681_COLOR_BLACK);
+    int fail = 0;
+
+    /* Store, overwrite, load back */
+    srand(7);
+    make_frame(frame);
+    memcpy(black, frame, SSD1681_PLANE_SIZE);
+    ssd1681_pages_init(arena, sizeof(arena));
+    fail |= check("store", ssd1681_page_store(0) != 0);
+    memset(black, 0x5A, SSD1681_PLANE_SIZE);
+    fail |= check("load", ssd1681_page_load(0) != 0 || memcmp(black, frame, SSD1681_PLANE_SIZE) != 0);
+
+    /* Truncated tokens are rejected, never read past the block */
+    uint8_t out[16];
+    const uint8_t literal_short[] = {0x05, 1, 2, 3};
+    const uint8_t repeat_short[] = {0x83};
+    const uint8_t too_long[] = {0x90, 0xAA};
+    const uint8_t good[] = {0x87, 0xAA, 0x02, 1, 2, 3, 0x84, 0x00};
+    fail |= check("literal past end", ssd1681_rle_decode(out, 16, 16, 16, literal_short, sizeof(literal_short)) != -5);
+    fail |= check("repeat past end", ssd1681_rle_decode(out, 16, 16, 16, repeat_short, sizeof(repeat_short)) != -5);
+    fail |= check("run past total", ssd1681_rle_decode(out, 16, 16, 16, too_long, sizeof(too_long)) != -5);
+    fail |= check("short output", ssd1681_rle_decode(out, 16, 16, 16, good, 6) != -5);
+
+    const uint8_t flat[16] = {0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 1, 2, 3, 0, 0, 0, 0, 0};
+    memset(out, 0x5A, sizeof(out));
+    fail |= check("flat", ssd1681_rle_decode(out, 16, 16, 16, good, sizeof(good)) != 0 ||
+                          memcmp(out, flat, sizeof(out)) != 0);
+
+    /* Strided: an RLE asset lands like the same asset drawn raw */
+    const uint8_t tokens[] = {0x82, 0xAA, 0x02, 1, 1, 2, 0x82, 3, 0x82, 0x00};
+    const uint8_t rows[4 * 3] = {0xAA, 0xAA, 0xAA, 1, 1, 2, 3, 3, 3, 0, 0, 0};
+    const ssd1681_asset_t raw = {24, 4, 3, SSD1681_ASSET_RAW, sizeof(rows), rows};
+    const ssd1681_asset_t rle = {24, 4, 3, SSD1681_ASSET_RLE, sizeof(tokens), tokens};
+    memset(black, 0xFF, SSD1681_PLANE_SIZE);
+    ssd1681_draw_asset(SSD1681_COLOR_BLACK, 16, 10, &raw);
+    memcpy(expected, black, SSD1681_PLANE_SIZE);
+    memset(black, 0xFF, SSD1681_PLANE_SIZE);
+    fail |= check("asset", ssd1681_draw_asset(SSD1681_COLOR_BLACK, 16, 10, &rle) != 0 ||
+                           memcmp(black, expected, SSD1681_PLANE_SIZE) != 0);
+
+    return fail ? 1 : 0;
+}
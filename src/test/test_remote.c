@@ -0,0 +1,127 @@
+/**
+ * Host test: decode streams written by tools/ssd1681_remote_send.py --out
+ *
+ *   test_remote gen <dir>    write the test frames as PBM
+ *   test_remote check <dir>  feed stream1.bin and stream2.bin, compare the planes with the frames
+ *
+ * Copyright (c) 2026 OpenCode
+ * SPDX-License-Identifier: MIT
+ */
+
+#include "pico_ssd1681_remote.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define W SSD1681_PANEL_WIDTH
+#define H SSD1681_PANEL_HEIGHT
+
+static int g_flush_status = 1;
+static int g_errors;
+
+/* Test frames, 1 = ink; frame 2 changes a band so the second stream is a delta */
+static int frame_ink(int frame, int plane, int x, int y)
+{
+    if (plane == 1) return (x / 10 + y / 10) % 7 == 0;
+    if (frame == 2 && y >= 60 && y < 90) return (x * 3 + y) % 5 == 0;
+    return ((x ^ y) & 8) != 0 && x > y / 2;
+}
+
+static int write_pbm(const char *dir, const char *name, int frame, int plane)
+{
+    char path[512];
+    snprintf(path, sizeof(path), "%s/%s", dir, name);
+    FILE *f = fopen(path, "wb");
+    if (!f) return -1;
+
+    fprintf(f, "P4\n%d %d\n", W, H);
+    for (int y = 0; y < H; y++) {
+        for (int x = 0; x < W; x += 8) {
+            uint8_t b = 0;
+            for (int k = 0; k < 8; k++) {
+                if (frame_ink(frame, plane, x + k, y)) b |= 0x80 >> k;
+            }
+            fputc(b, f);
+        }
+    }
+    return fclose(f);
+}
+
+/* Replies: 0xE5, type, len16, status, ..., crc16 */
+static void capture_reply(const uint8_t *data, uint16_t len)
+{
+    if (len < 5) return;
+    int8_t status = (int8_t)data[4];
+    if (data[1] == (SSD1681_REMOTE_FLUSH | 0x80)) g_flush_status = status;
+    if (status != 0) {
+        printf("reply 0x%02x status %d\n", data[1], status);
+        g_errors++;
+    }
+}
+
+static int feed_file(const char *dir, const char *name)
+{
+    char path[512];
+    snprintf(path, sizeof(path), "%s/%s", dir, name);
+    FILE *f = fopen(path, "rb");
+    if (!f) {
+        printf("cannot open %s\n", path);
+        return -1;
+    }
+
+    /* Odd chunk size so packets straddle feed calls */
+    uint8_t chunk[97];
+    size_t n;
+    int packets = 0;
+    while ((n = fread(chunk, 1, sizeof(chunk), f)) > 0) {
+        packets += ssd1681_remote_feed(chunk, (uint32_t)n);
+    }
+    fclose(f);
+    return packets;
+}
+
+static int compare(int frame)
+{
+    int bad = 0;
+    for (int plane = 0; plane < 2; plane++) {
+        const uint8_t *gram = ssd1681_get_framebuffer((ssd1681_color_t)plane);
+        for (int y = 0; y < H; y++) {
+            for (int x = 0; x < W; x++) {
+                int ink = !((gram[(H - 1 - y) * SSD1681_PLANE_STRIDE + x / 8] >> (7 - x % 8)) & 1);
+                if (ink != frame_ink(frame, plane, x, y)) bad++;
+            }
+        }
+    }
+    printf("frame %d: %d mismatched pixels\n", frame, bad);
+    return bad;
+}
+
+int main(int argc, char **argv)
+{
+    if (argc != 3) {
+        fprintf(stderr, "usage: %s gen|check <dir>\n", argv[0]);
+        return 2;
+    }
+
+    if (strcmp(argv[1], "gen") == 0) {
+        return (write_pbm(argv[2], "frame1.pbm", 1, 0) || write_pbm(argv[2], "frame2.pbm", 2, 0) ||
+                write_pbm(argv[2], "red.pbm", 1, 1)) ? 1 : 0;
+    }
+
+    ssd1681_config_t config;
+    ssd1681_get_default_config_4wire(&config);
+    if (ssd1681_init(&config) != 0) return 1;
+    ssd1681_remote_init(capture_reply);
+
+    int fail = 0;
+    if (feed_file(argv[2], "stream1.bin") <= 0) return 1;
+    fail |= compare(1) != 0 || g_flush_status != 0;
+
+    /* Second stream is a delta flushed with FAST_FULL */
+    g_flush_status = 1;
+    if (feed_file(argv[2], "stream2.bin") <= 0) return 1;
+    fail |= compare(2) != 0 || g_flush_status != 0;
+
+    return (fail || g_errors) ? 1 : 0;
+}
@@ -0,0 +1,176 @@
+#!/usr/bin/env python3
+"""
+Convert PNG/PBM images into SSD1681 controller-native C arrays.
+
+The output is already in plane layout: 1 = white, MSB is the leftmost pixel,
+rows byte-aligned and stored bottom-up. ssd1681_draw_asset() can then copy it
+into a plane with memcpy, and ssd1681_write_asset() can stream it straight to
+RAM. Optional RLE uses the run-length tokens described in pico_ssd1681.h,
+encoded by ssd1681_codec.py like the remote protocol and the page cache.
+
+  ssd1681_asset.py logo.png --name logo --out-dir build/assets [--rle] [--threshold 128]
+
+Writes <name>.c and <name>.h declaring `extern const ssd1681_asset_t asset_<name>;`.
+Used by ssd1681_add_assets() in CMakeLists.txt.
+
+Copyright (c) 2026 OpenCode
+SPDX-License-Identifier: MIT
+"""
+
+import argparse
+import os
+import re
+import struct
+import sys
+import zlib
+
+sys.path.insert(0, os.path.dirname(os.path.abspath(__file__)))
+from ssd1681_codec import read_pbm, rle_tokens, to_plane  # noqa: E402
+
+
+def read_png(data, threshold):
+    """Minimal PNG decoder: non-interlaced gray, RGB, palette, gray+alpha and RGBA."""
+    if data[:8] != b"\x89PNG\r\n\x1a\n":
+        raise ValueError("not a PNG file")
+
+    pos = 8
+    idat = b""
+    palette = []
+    trns = b""
+    while pos < len(data):
+        length, ctype = struct.unpack(">I4s", data[pos:pos + 8])
+        chunk = data[pos + 8:pos + 8 + length]
+        pos += 12 + length
+        if ctype == b"IHDR":
+            width, height, depth, color, _, _, interlace = struct.unpack(">IIBBBBB", chunk)
+        elif ctype == b"PLTE":
+            palette = [tuple(chunk[i:i + 3]) for i in range(0, len(chunk), 3)]
+        elif ctype == b"tRNS":
+            trns = chunk
+        elif ctype == b"IDAT":
+            idat += chunk
+        elif ctype == b"IEND":
+            break
+
+    if interlace:
+        raise ValueError("interlaced PNG is not supported")
+    channels = {0: 1, 2: 3, 3: 1, 4: 2, 6: 4}[color]
+    if depth == 16:
+        raise ValueError("16-bit PNG is not supported")
+
+    bpp = max(1, channels * depth // 8)
+    stride = (width * channels * depth + 7) // 8
+    raw = zlib.decompress(idat)
+    rows = []
+    prev = bytearray(stride)
+    for y in range(height):
+        ftype = raw[y * (stride + 1)]
+        line = bytearray(raw[y * (stride + 1) + 1:(y + 1) * (stride + 1)])
+        for i in range(stride):
+            a = line[i - bpp] if i >= bpp else 0
+            b = prev[i]
+            c = prev[i - bpp] if i >= bpp else 0
+            if ftype == 1:
+                line[i] = (line[i] + a) & 0xFF
+            elif ftype == 2:
+                line[i] = (line[i] + b) & 0xFF
+            elif ftype == 3:
+                line[i] = (line[i] + ((a + b) >> 1)) & 0xFF
+            elif ftype == 4:
+                p = a + b - c
+                pa, pb, pc = abs(p - a), abs(p - b), abs(p - c)
+                pred = a if pa <= pb and pa <= pc else (b if pb <= pc else c)
+                line[i] = (line[i] + pred) & 0xFF
+        rows.append(line)
+        prev = line
+
+    def samples(line):
+        if depth == 8:
+            return list(line)
+        per = 8 // depth
+        mask = (1 << depth) - 1
+        return [(line[i // per] >> (8 - depth * (i % per + 1))) & mask
+                for i in range(width * channels)]
+
+    scale = 255 // ((1 << depth) - 1)
+    ink = []
+    for line in rows:
+        s = samples(line)
+        out = []
+        for x in range(width):
+            px = s[x * channels:(x + 1) * channels]
+            alpha = 255
+            if color == 3:
+                r, g, b = palette[px[0]]
+                alpha = trns[px[0]] if px[0] < len(trns) else 255
+            elif color in (0, 4):
+                r = g = b = px[0] * scale
+                if color == 4:
+                    alpha = px[1]
+            else:
+                r, g, b = px[0], px[1], px[2]
+                if color == 6:
+                    alpha = px[3]
+            luma = (77 * r + 150 * g + 29 * b) >> 8
+            out.append(alpha >= 128 and luma < threshold)  # Transparent pixels stay white
+        ink.append(out)
+    return width, height, ink
+
+
+def c_bytes(data):
+    lines = []
+    for i in range(0, len(data), 16):
+        lines.append("    " + ", ".join(f"0x{b:02X}" for b in data[i:i + 16]) + ",")
+    return "\n".join(lines)
+
+
+def main():
+    ap = argparse.ArgumentParser(description=__doc__.split("\n\n")[0])
+    ap.add_argument("image", help="PNG or PBM file")
+    ap.add_argument("--name", help="C identifier (default: file name)")
+    ap.add_argument("--out-dir", default=".")
+    ap.add_argument("--rle", action="store_true", help="compress (kept raw if RLE is not smaller)")
+    ap.add_argument("--threshold", type=int, default=128, help="PNG luma below this is ink")
+    args = ap.parse_args()
+
+    with open(args.image, "rb") as f:
+        data = f.read()
+    try:
+        if data[:8] == b"\x89PNG\r\n\x1a\n":
+            width, height, ink = read_png(data, args.threshold)
+        else:
+            width, height, ink = read_pbm(data)
+    except (ValueError, KeyError, IndexError, zlib.error) as e:
+        sys.exit(f"{args.image}: {e}")
+
+    name = args.name or os.path.splitext(os.path.basename(args.image))[0]
+    name = re.sub(r"\W", "_", name)
+    if name[0].isdigit():
+        name = "_" + name
+
+    stride, plane = to_plane(width, height, ink)
+    encoding, payload = "SSD1681_ASSET_RAW", plane
+    if args.rle:
+        packed = rle_tokens(plane)
+        if len(packed) < len(plane):
+            encoding, payload = "SSD1681_ASSET_RLE", packed
+
+    os.makedirs(args.out_dir, exist_ok=True)
+    guard = f"SSD1681_ASSET_{name.upper()}_H"
+    with open(os.path.join(args.out_dir, f"{name}.h"), "w") as f:
+        f.write(f"/* Generated by ssd1681_asset.py from {os.path.basename(args.image)}, do not edit */\n\n")
+        f.write(f"#ifndef {guard}\n#define {guard}\n\n#include \"pico_ssd1681.h\"\n\n")
+        f.write(f"extern const ssd1681_asset_t asset_{name};\n\n#endif\n")
+    with open(os.path.join(args.out_dir, f"{name}.c"), "w") as f:
+        f.write(f"/* Generated by ssd1681_asset.py from {os.path.basename(args.image)}, do not edit */\n\n")
+        f.write(f"#include \"{name}.h\"\n\n")
+        f.write(f"static const uint8_t asset_{name}_data[{len(payload)}] __attribute__((aligned(4))) = {{\n")
+        f.write(c_bytes(payload) + "\n};\n\n")
+        f.write(f"const ssd1681_asset_t asset_{name} = {{\n")
+        f.write(f"    .width = {width},\n    .height = {height},\n    .stride = {stride},\n")
+        f.write(f"    .encoding = {encoding},\n    .size = {len(payload)},\n")
+        f.write(f"    .data = asset_{name}_data,\n}};\n")
+
+
+if __name__ == "__main__":
+    main()
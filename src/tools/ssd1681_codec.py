@@ -0,0 +1,95 @@
+"""
+Image and run-length helpers shared by the SSD1681 host tools.
+
+Planes are in controller-native layout: 1 = white, MSB is the leftmost pixel,
+rows padded to a byte and stored bottom-up. The run-length token format is
+described once, with the asset encodings in pico_ssd1681.h; rle_tokens()
+produces the same tokens as the page cache encoder in pico_ssd1681_pages.c.
+
+Copyright (c) 2026 OpenCode
+SPDX-License-Identifier: MIT
+"""
+
+# Shortest run stored as a repeat token, shorter runs stay in literals
+MIN_RUN = 3
+
+
+def read_pbm(data):
+    """Return (width, height, ink) where ink[y][x] is True for black pixels."""
+    pos = 0
+
+    def token():
+        nonlocal pos
+        while True:
+            while pos < len(data) and data[pos:pos + 1].isspace():
+                pos += 1
+            if data[pos:pos + 1] == b"#":
+                while pos < len(data) and data[pos:pos + 1] not in (b"\n", b"\r"):
+                    pos += 1
+                continue
+            break
+        start = pos
+        while pos < len(data) and not data[pos:pos + 1].isspace():
+            pos += 1
+        return data[start:pos]
+
+    magic = token()
+    width, height = int(token()), int(token())
+    ink = []
+    if magic == b"P4":
+        pos += 1  # single whitespace before the raster
+        stride = (width + 7) // 8
+        for y in range(height):
+            row = data[pos + y * stride:pos + (y + 1) * stride]
+            ink.append([bool(row[x // 8] & (0x80 >> (x % 8))) for x in range(width)])
+    elif magic == b"P1":
+        bits = [c for c in data[pos:] if c in b"01"]
+        for y in range(height):
+            ink.append([bits[y * width + x] == ord("1") for x in range(width)])
+    else:
+        raise ValueError("not a PBM file")
+    return width, height, ink
+
+
+def to_plane(width, height, ink):
+    """Pack into native layout: 1 = white, MSB leftmost, rows bottom-up, padded to a byte."""
+    stride = (width + 7) // 8
+    out = bytearray()
+    for y in reversed(range(height)):
+        row = bytearray(b"\xff" * stride)
+        for x in range(width):
+            if ink[y][x]:
+                row[x // 8] &= ~(0x80 >> (x % 8)) & 0xFF
+        out += row
+    return stride, bytes(out)
+
+
+def rle_tokens(data, skip_zero=False):
+    """Encode data as run-length tokens; with skip_zero, zero runs are skips (remote XOR_RLE)."""
+    out = bytearray()
+    i = 0
+    n = len(data)
+    while i < n:
+        run = 1
+        while i + run < n and run < 128 and data[i + run] == data[i]:
+            run += 1
+        if skip_zero and data[i] == 0:
+            out.append(0x80 | (run - 1))
+            i += run
+            continue
+        if not skip_zero and run >= MIN_RUN:
+            out += bytes([0x80 | (run - 1), data[i]])
+            i += run
+            continue
+        # Literals up to the next run worth a token
+        start = i
+        while i < n and i - start < 128:
+            run = 1
+            while i + run < n and run < MIN_RUN and data[i + run] == data[i]:
+                run += 1
+            if (skip_zero and data[i] == 0) or (not skip_zero and run >= MIN_RUN):
+                break
+            i += 1
+        out.append(i - start - 1)
+        out += data[start:i]
+    return bytes(out)
@@ -0,0 +1,223 @@
+#!/usr/bin/env python3
+"""
+Push an image to an SSD1681 panel running the remote framebuffer protocol.
+
+Images are PBM files (P1 or P4) of the panel size, 1 = ink. Only rows that
+differ from the previously sent frame are transmitted, each chunk in the
+smallest of RAW, XOR_RLE (delta) and RLE encodings; see pico_ssd1681_remote.h
+for the wire format and pico_ssd1681.h for the run-length tokens. The last frame is kept in a state file so the next run
+can send a delta.
+
+  ssd1681_remote_send.py --port /dev/ttyACM0 --black frame.pbm --update partial
+  ssd1681_remote_send.py --out stream.bin --black frame.pbm    # no device, write the byte stream
+
+Copyright (c) 2026 OpenCode
+SPDX-License-Identifier: MIT
+"""
+
+import argparse
+import os
+import struct
+import sys
+import time
+
+sys.path.insert(0, os.path.dirname(os.path.abspath(__file__)))
+from ssd1681_codec import read_pbm, rle_tokens, to_plane  # noqa: E402
+
+SYNC = 0xE5
+HELLO, ROWS, FLUSH = 0x01, 0x02, 0x03
+RAW, XOR_RLE, RLE = 0, 1, 2
+UPDATES = {"partial": 0, "full": 1, "fast-full": 2, "aggressive": 3}
+
+# Rows of unchanged data worth sending to avoid a packet header (6 bytes + framing)
+MERGE_GAP_ROWS = 1
+
+
+def crc16(data, crc=0xFFFF):
+    for b in data:
+        crc ^= b << 8
+        for _ in range(8):
+            crc = ((crc << 1) ^ 0x1021) if crc & 0x8000 else crc << 1
+            crc &= 0xFFFF
+    return crc
+
+
+def packet(ptype, payload=b""):
+    body = struct.pack("<BH", ptype, len(payload)) + payload
+    return bytes([SYNC]) + body + struct.pack("<H", crc16(body))
+
+
+def read_plane(path, width, height):
+    """Return the image as a native plane: bottom-up rows, MSB = left, 1 = white."""
+    with open(path, "rb") as f:
+        data = f.read()
+    try:
+        w, h, ink = read_pbm(data)
+    except (ValueError, IndexError) as e:
+        sys.exit(f"{path}: {e}")
+    if (w, h) != (width, height):
+        sys.exit(f"{path}: image is {w}x{h}, panel is {width}x{height}")
+    return to_plane(width, height, ink)[1]
+
+
+def encode(old, new):
+    """Pick the smallest encoding for one row range."""
+    delta = bytes(a ^ b for a, b in zip(old, new))
+    options = [
+        (RAW, new),
+        (XOR_RLE, rle_tokens(delta, True)),
+        (RLE, rle_tokens(new, False)),
+    ]
+    return min(options, key=lambda o: len(o[1]))
+
+
+def changed_ranges(old, new, stride, height):
+    """Yield (first, last) native row ranges that changed, merging small gaps."""
+    ranges = []
+    for r in range(height):
+        if old[r * stride:(r + 1) * stride] != new[r * stride:(r + 1) * stride]:
+            if ranges and r - ranges[-1][1] <= MERGE_GAP_ROWS + 1:
+                ranges[-1][1] = r
+            else:
+                ranges.append([r, r])
+    return ranges
+
+
+def row_packets(color, old, new, width, height, max_payload):
+    stride = width // 8
+    for first, last in changed_ranges(old, new, stride, height):
+        r = first
+        while r <= last:
+            # Grow the chunk while its best encoding still fits one packet
+            end = r
+            best = encode(old[r * stride:(r + 1) * stride], new[r * stride:(r + 1) * stride])
+            while end < last:
+                a, b = r * stride, (end + 2) * stride
+                cand = encode(old[a:b], new[a:b])
+                if len(cand[1]) + 6 > max_payload:
+                    break
+                best, end = cand, end + 1
+            enc, data = best
+            # Native rows r..end are display rows (height-1-end)..(height-1-r)
+            top, bottom = height - 1 - end, height - 1 - r
+            yield packet(ROWS, struct.pack("<BBHH", color, enc, top, bottom) + data)
+            r = end + 1
+
+
+class Port:
+    def __init__(self, path):
+        self.fd = os.open(path, os.O_RDWR | os.O_NOCTTY)
+        try:
+            import termios
+            import tty
+            tty.setraw(self.fd)
+            termios.tcflush(self.fd, termios.TCIFLUSH)
+        except (ImportError, OSError):
+            pass
+        self.buf = bytearray()
+
+    def send(self, pkt, timeout):
+        os.write(self.fd, pkt)
+        return self.reply(pkt[1] | 0x80, timeout)
+
+    def reply(self, rtype, timeout):
+        import select
+        deadline = time.monotonic() + timeout
+        while True:
+            # Scan for a complete, valid reply; stdio text from the device is skipped
+            while len(self.buf) >= 7:
+                if self.buf[0] != SYNC:
+                    del self.buf[0]
+                    continue
+                ptype, length = struct.unpack_from("<BH", self.buf, 1)
+                if length > 64:
+                    del self.buf[0]
+                    continue
+                if len(self.buf) < 4 + length + 2:
+                    break
+                body = bytes(self.buf[1:4 + length])
+                crc, = struct.unpack_from("<H", self.buf, 4 + length)
+                if crc16(body) != crc or ptype != rtype:
+                    del self.buf[0]
+                    continue
+                payload = body[3:]
+                del self.buf[:4 + length + 2]
+                return payload
+            left = deadline - time.monotonic()
+            if left <= 0:
+                sys.exit(f"timeout waiting for reply 0x{rtype:02x}")
+            ready, _, _ = select.select([self.fd], [], [], left)
+            if ready:
+                self.buf += os.read(self.fd, 4096)
+
+
+def main():
+    ap = argparse.ArgumentParser(description=__doc__.split("\n\n")[0])
+    ap.add_argument("--port", help="serial device of the panel (USB-CDC)")
+    ap.add_argument("--out", help="write the byte stream to a file ('-' for stdout) instead")
+    ap.add_argument("--black", required=True, help="black plane, PBM")
+    ap.add_argument("--red", help="red plane, PBM")
+    ap.add_argument("--update", choices=UPDATES, default="partial")
+    ap.add_argument("--state", default=".ssd1681_remote_state", help="last sent frame (for deltas)")
+    ap.add_argument("--full", action="store_true", help="ignore the state file, send everything")
+    ap.add_argument("--size", default="200x200", help="panel size for --out (default 200x200)")
+    ap.add_argument("--max-payload", type=int, default=1024, help="packet payload limit for --out")
+    args = ap.parse_args()
+
+    if bool(args.port) == bool(args.out):
+        ap.error("give exactly one of --port or --out")
+
+    port = None
+    width, height = (int(v) for v in args.size.split("x"))
+    max_payload = args.max_payload
+    planes = 2 if args.red else 1
+
+    if args.port:
+        port = Port(args.port)
+        info = port.send(packet(HELLO), 2.0)
+        if info[0] != 0:
+            sys.exit("device rejected HELLO")
+        width, height, planes, max_payload = struct.unpack_from("<HHBH", info, 1)
+        if args.red and planes < 2:
+            sys.exit("device has no red plane")
+
+    size = width // 8 * height
+    new = [read_plane(args.black, width, height)]
+    if args.red:
+        new.append(read_plane(args.red, width, height))
+
+    old = [b"\xff" * size, b"\xff" * size]
+    if not args.full and os.path.exists(args.state):
+        with open(args.state, "rb") as f:
+            saved = f.read()
+        if len(saved) == 2 * size:
+            old = [saved[:size], saved[size:]]
+
+    packets = []
+    for color, plane in enumerate(new):
+        packets += row_packets(color, old[color], plane, width, height, max_payload)
+    packets.append(packet(FLUSH, bytes([UPDATES[args.update]])))
+
+    sent = sum(len(p) for p in packets)
+    if port:
+        for p in packets:
+            timeout = 30.0 if p[1] == FLUSH else 5.0
+            status = port.send(p, timeout)[0]
+            if status != 0:
+                sys.exit(f"device returned status {status - 256 if status > 127 else status}")
+    else:
+        stream = b"".join(packets)
+        if args.out == "-":
+            sys.stdout.buffer.write(stream)
+        else:
+            with open(args.out, "wb") as f:
+                f.write(stream)
+
+    with open(args.state, "wb") as f:
+        f.write(new[0] + (new[1] if len(new) > 1 else old[1]))
+
+    print(f"{len(packets)} packets, {sent} bytes (full frame {size * len(new)} bytes)", file=sys.stderr)
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,103 @@
+#!/usr/bin/env python3
+"""
+Compare an SSD1681 bus trace against a golden capture.
+
+Traces are the text export of ssd1681_trace_print(). Commands and data
+(length + hash) must match exactly; BUSY waits and the gaps between events
+are compared against a relative tolerance so phase timing regressions show up.
+
+Copyright (c) 2026 OpenCode
+SPDX-License-Identifier: MIT
+"""
+
+import argparse
+import sys
+
+
+def load(path):
+    events = []
+    with open(path) as f:
+        for lineno, line in enumerate(f, 1):
+            line = line.strip()
+            if not line or line.startswith("#"):
+                continue
+            parts = line.split()
+            try:
+                t = int(parts[0])
+                kind = parts[1]
+                if kind == "C":
+                    events.append((t, "C", int(parts[2], 16), None))
+                elif kind == "D":
+                    events.append((t, "D", int(parts[2]), parts[3]))
+                elif kind == "B":
+                    events.append((t, "B", int(parts[2]), None))
+                else:
+                    raise ValueError(kind)
+            except (IndexError, ValueError):
+                sys.exit(f"{path}:{lineno}: malformed trace line: {line}")
+    return events
+
+
+def describe(ev):
+    _, kind, value, extra = ev
+    if kind == "C":
+        return f"cmd 0x{value:02x}"
+    if kind == "D":
+        return f"data len={value} hash={extra}"
+    return f"busy {value} us"
+
+
+def within(actual, expected, tolerance, floor_us):
+    return abs(actual - expected) <= max(expected * tolerance, floor_us)
+
+
+def main():
+    ap = argparse.ArgumentParser(description=__doc__.splitlines()[1])
+    ap.add_argument("golden", help="golden trace")
+    ap.add_argument("trace", help="captured trace")
+    ap.add_argument("--tolerance", type=float, default=0.2,
+                    help="relative timing tolerance (default 0.2)")
+    ap.add_argument("--floor-us", type=int, default=500,
+                    help="timing differences below this are ignored (default 500)")
+    ap.add_argument("--no-timing", action="store_true", help="compare bytes on the wire only")
+    args = ap.parse_args()
+
+    golden = load(args.golden)
+    trace = load(args.trace)
+    errors = 0
+
+    for i, (g, t) in enumerate(zip(golden, trace)):
+        if g[1] != t[1] or (g[1] != "B" and (g[2], g[3]) != (t[2], t[3])):
+            print(f"event {i}: expected {describe(g)}, got {describe(t)}")
+            errors += 1
+            break  # Everything after a sequence mismatch is noise
+
+        if args.no_timing:
+            continue
+
+        if g[1] == "B" and not within(t[2], g[2], args.tolerance, args.floor_us):
+            print(f"event {i}: busy {t[2]} us, golden {g[2]} us")
+            errors += 1
+
+        if i > 0:
+            gap_g = g[0] - golden[i - 1][0]
+            gap_t = t[0] - trace[i - 1][0]
+            if not within(gap_t, gap_g, args.tolerance, args.floor_us):
+                print(f"event {i} ({describe(t)}): started {gap_t} us after previous, golden {gap_g} us")
+                errors += 1
+
+    if len(golden) != len(trace) and errors == 0:
+        print(f"length differs: golden {len(golden)} events, trace {len(trace)} events")
+        errors += 1
+
+    if not args.no_timing and golden and trace and errors == 0:
+        total_g = golden[-1][0] - golden[0][0]
+        total_t = trace[-1][0] - trace[0][0]
+        print(f"total {total_t} us (golden {total_g} us)")
+
+    print("OK" if errors == 0 else f"{errors} difference(s)")
+    return 1 if errors else 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())